@@ -0,0 +1,90 @@
+/*
+  Benchmarks | Aggregate Queue
+
+  Computes the rolling minimum and sum over a stream of `events` elements
+  for several window sizes. One version keeps the window in an
+  `AggregateQueue` and queries it after every event. The other keeps it
+  in a ring buffer and rescans the whole window each time. The rescan is
+  O(window) per event; the queue is amortized O(1).
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/AggregateQueueBenchmark.cpp -o aggregatequeue && ./aggregatequeue
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/queues/AggregateQueue.cpp"
+
+#include <chrono>
+
+volatile long long sink;
+
+template <typename Operator>
+double withQueue(const std::vector<int> &stream, unsigned int window)
+{
+  typedef std::chrono::steady_clock Clock;
+  AggregateQueue<Operator> queue;
+  long long total = 0;
+  auto start = Clock::now();
+  for (auto element : stream)
+  {
+    queue.push(element);
+    if (queue.size() > window) queue.pop();
+    total += queue.query();
+  }
+  auto milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  sink = total;
+  return milliseconds;
+}
+
+template <typename Operator>
+double withRescan(const std::vector<int> &stream, unsigned int window)
+{
+  typedef std::chrono::steady_clock Clock;
+  std::vector<int> ring(window);
+  unsigned int filled = 0;
+  long long total = 0;
+  auto start = Clock::now();
+  for (unsigned int i = 0; i < stream.size(); i++)
+  {
+    ring[i % window] = stream[i];
+    if (filled < window) filled++;
+    auto aggregate = ring[0];
+    for (unsigned int j = 1; j < filled; j++) aggregate = Operator::combine(aggregate, ring[j]);
+    total += aggregate;
+  }
+  auto milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  sink = total;
+  return milliseconds;
+}
+
+template <typename Operator>
+void measure(const char *aggregate, const std::vector<int> &stream, unsigned int window)
+{
+  auto queueMilliseconds = withQueue<Operator>(stream, window);
+  auto rescanMilliseconds = withRescan<Operator>(stream, window);
+  std::cout << aggregate << "," << window << "," << stream.size() << "," << queueMilliseconds << ","
+            << rescanMilliseconds << "," << rescanMilliseconds / queueMilliseconds << std::endl;
+}
+
+int main()
+{
+  const unsigned int events = 2000000;
+  unsigned int windows[] = {16, 256, 4096};
+
+  std::vector<int> stream(events);
+  unsigned int seed = 12345;
+  for (auto &element : stream)
+  {
+    seed = seed * 1103515245 + 12345;
+    element = (int)((seed >> 8) % 2001) - 1000;
+  }
+
+  std::cout << "aggregate,window,events,queue_ms,rescan_ms,speedup" << std::endl;
+  for (auto window : windows)
+  {
+    measure<MinAggregate>("min", stream, window);
+    measure<SumAggregate>("sum", stream, window);
+  }
+
+  return 0;
+}
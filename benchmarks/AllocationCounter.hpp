@@ -0,0 +1,75 @@
+/*
+  Benchmarks | Allocation Counter
+
+  Counts calls into the C allocator (`malloc`, `calloc`, `realloc` and the
+  aligned `aligned_alloc`, `posix_memalign`, `memalign`) by interposing
+  them in the benchmark executable. `operator new` ends up in `malloc`, and
+  its over-aligned form in `aligned_alloc`, so heap allocations made
+  through any of these paths are counted. Only glibc exposes the `__libc_*` entry points this relies on.
+  On other platforms the counter stays at zero.
+
+  Include this header from exactly one translation unit per executable.
+*/
+
+#ifndef DSA_ALLOCATION_COUNTER_HPP
+#define DSA_ALLOCATION_COUNTER_HPP
+
+#include <cerrno>
+#include <cstddef>
+
+namespace allocations
+{
+  inline unsigned long long count = 0;
+}
+
+#ifdef __GLIBC__
+extern "C"
+{
+  void *__libc_malloc(std::size_t size);
+  void *__libc_calloc(std::size_t count, std::size_t size);
+  void *__libc_realloc(void *ptr, std::size_t size);
+  void *__libc_memalign(std::size_t alignment, std::size_t size);
+
+  void *malloc(std::size_t size)
+  {
+    allocations::count++;
+    return __libc_malloc(size);
+  }
+
+  void *calloc(std::size_t count, std::size_t size)
+  {
+    allocations::count++;
+    return __libc_calloc(count, size);
+  }
+
+  void *realloc(void *ptr, std::size_t size)
+  {
+    allocations::count++;
+    return __libc_realloc(ptr, size);
+  }
+
+  void *aligned_alloc(std::size_t alignment, std::size_t size)
+  {
+    allocations::count++;
+    return __libc_memalign(alignment, size);
+  }
+
+  void *memalign(std::size_t alignment, std::size_t size)
+  {
+    allocations::count++;
+    return __libc_memalign(alignment, size);
+  }
+
+  int posix_memalign(void **ptr, std::size_t alignment, std::size_t size)
+  {
+    if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0) return EINVAL;
+    allocations::count++;
+    auto *allocationPtr = __libc_memalign(alignment, size);
+    if (allocationPtr == nullptr && size != 0) return ENOMEM;
+    *ptr = allocationPtr;
+    return 0;
+  }
+}
+#endif
+
+#endif
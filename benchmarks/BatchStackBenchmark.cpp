@@ -0,0 +1,105 @@
+/*
+  Benchmarks | Batch Stack
+
+  Hands `total` elements through each stack in batches of `batch`, once
+  with a `push`/`pop` call per element and once with one `pushN`/`popN`
+  call per batch. Each round pushes a batch and pops it again, the way a
+  producer stage hands work to the next one. The stack starts out holding
+  `batch` elements so that the dynamic array does not shrink and regrow
+  every round. The list stack still allocates and frees a node per
+  element either way, so batching saves it much less than the arrays.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/BatchStackBenchmark.cpp -o batchstack && ./batchstack
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/stacks/StackStaticArray.cpp"
+#include "../data-structures/stacks/StackDynamicArray.cpp"
+#include "../data-structures/stacks/StackDoublyLinkedList.cpp"
+
+#include <chrono>
+#include <memory>
+
+volatile long long sink;
+
+template <typename Stack>
+double perElement(Stack &stack, unsigned int batch, unsigned int total)
+{
+  typedef std::chrono::steady_clock Clock;
+  std::vector<int> elements(batch);
+  for (unsigned int i = 0; i < batch; i++) elements[i] = i;
+  long long sum = 0;
+  auto start = Clock::now();
+  for (unsigned int round = 0; round < total / batch; round++)
+  {
+    for (unsigned int i = 0; i < batch; i++) stack.push(elements[i]);
+    for (unsigned int i = 0; i < batch; i++) elements[batch - 1 - i] = stack.pop();
+    sum += elements[0];
+  }
+  auto milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  sink = sum;
+  return milliseconds;
+}
+
+template <typename Stack>
+double batched(Stack &stack, unsigned int batch, unsigned int total)
+{
+  typedef std::chrono::steady_clock Clock;
+  std::vector<int> elements(batch);
+  for (unsigned int i = 0; i < batch; i++) elements[i] = i;
+  long long sum = 0;
+  auto start = Clock::now();
+  for (unsigned int round = 0; round < total / batch; round++)
+  {
+    stack.pushN(elements.data(), batch);
+    stack.popN(elements.data(), batch);
+    sum += elements[0];
+  }
+  auto milliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  sink = sum;
+  return milliseconds;
+}
+
+template <typename Stack>
+void measure(const char *container, std::unique_ptr<Stack> (*make)(unsigned int), unsigned int batch,
+             unsigned int total)
+{
+  std::vector<int> base(batch, -1);
+  auto singleStack = make(batch);
+  auto batchStack = make(batch);
+  singleStack->pushN(base.data(), batch);
+  batchStack->pushN(base.data(), batch);
+  auto singleMilliseconds = perElement(*singleStack, batch, total);
+  auto batchMilliseconds = batched(*batchStack, batch, total);
+  std::cout << container << "," << batch << "," << total << "," << singleMilliseconds << "," << batchMilliseconds
+            << "," << singleMilliseconds / batchMilliseconds << std::endl;
+}
+
+std::unique_ptr<StackStaticArray<>> makeStatic(unsigned int batch)
+{
+  return std::unique_ptr<StackStaticArray<>>(new StackStaticArray<>(2 * batch));
+}
+
+std::unique_ptr<StackDynamicArray<>> makeDynamic(unsigned int) { return std::unique_ptr<StackDynamicArray<>>(new StackDynamicArray<>()); }
+
+std::unique_ptr<StackDoublyLinkedList> makeList(unsigned int)
+{
+  return std::unique_ptr<StackDoublyLinkedList>(new StackDoublyLinkedList());
+}
+
+int main()
+{
+  const unsigned int total = 1 << 24;
+  unsigned int batches[] = {64, 256, 1024};
+
+  std::cout << "container,batch,elements,per_element_ms,batch_ms,speedup" << std::endl;
+  for (auto batch : batches)
+  {
+    measure("StackStaticArray", makeStatic, batch, total);
+    measure("StackDynamicArray", makeDynamic, batch, total);
+    measure("StackDoublyLinkedList", makeList, batch, total);
+  }
+
+  return 0;
+}
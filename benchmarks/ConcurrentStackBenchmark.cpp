@@ -0,0 +1,130 @@
+/*
+  Benchmarks | Concurrent Stacks
+
+  Every thread runs push/pop pairs on one shared stack for a fixed time.
+  `StackDoublyLinkedList` behind a `std::mutex` is the baseline; the
+  lock-free stacks are timed at the same thread counts. Throughput is in
+  completed operations (a push or a pop) per second across all threads.
+  Every 64th push/pop pair is also timed on its own, and the 99th
+  percentile of those samples is reported as the tail latency of a pair.
+  The first line reports how many hardware threads the machine has.
+  Thread counts up to it measure scaling; counts above it measure
+  oversubscription, where a preempted lock holder stalls everyone and a
+  lock-free stack does not.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG -pthread benchmarks/ConcurrentStackBenchmark.cpp -o concurrentstack && ./concurrentstack
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/stacks/StackDoublyLinkedList.cpp"
+#include "../data-structures/stacks/StackLockFreeLinkedList.cpp"
+#include "../data-structures/stacks/StackLockFreeArray.cpp"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class MutexStack
+{
+private:
+  StackDoublyLinkedList _stack;
+  std::mutex _mutex;
+
+public:
+  void push(int data)
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_stack.push(data);
+  }
+
+  bool tryPop(int &data)
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    if (this->_stack.empty()) return false;
+    data = this->_stack.pop();
+    return true;
+  }
+};
+
+class BoundedStack : public StackLockFreeArray<CacheAlignedAllocation>
+{
+public:
+  BoundedStack() : StackLockFreeArray<CacheAlignedAllocation>(1 << 16) {}
+};
+
+struct Result
+{
+  double operationsPerSecond;
+  double p99Nanoseconds;
+};
+
+template <typename Stack>
+Result run(unsigned int threads, double seconds)
+{
+  typedef std::chrono::steady_clock Clock;
+  Stack stack;
+  for (int i = 0; i < 1024; i++) stack.push(i);
+  std::atomic<bool> isRunning(true);
+  std::vector<unsigned long long> operations(threads, 0);
+  std::vector<std::vector<double>> samples(threads);
+  std::vector<std::thread> workers;
+  for (unsigned int t = 0; t < threads; t++)
+  {
+    workers.emplace_back([&, t] {
+      unsigned long long count = 0;
+      int data;
+      for (unsigned int pair = 0; isRunning.load(std::memory_order_relaxed); pair++)
+      {
+        if (pair % 64 != 0)
+        {
+          stack.push((int)count);
+          count += 1 + stack.tryPop(data);
+          continue;
+        }
+        auto start = Clock::now();
+        stack.push((int)count);
+        count += 1 + stack.tryPop(data);
+        samples[t].push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+      }
+      operations[t] = count;
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  isRunning.store(false);
+  for (auto &worker : workers) worker.join();
+  unsigned long long total = 0;
+  std::vector<double> latencies;
+  for (unsigned int t = 0; t < threads; t++)
+  {
+    total += operations[t];
+    latencies.insert(latencies.end(), samples[t].begin(), samples[t].end());
+  }
+  auto p99 = latencies.begin() + latencies.size() * 99 / 100;
+  std::nth_element(latencies.begin(), p99, latencies.end());
+  return {total / seconds, *p99};
+}
+
+int main()
+{
+  unsigned int threadCounts[] = {1, 2, 4, 8, 16};
+  double seconds = 0.5;
+
+  std::cout << "hardware_threads," << std::thread::hardware_concurrency() << std::endl;
+  std::cout << "threads,mutex_ops_per_second,mutex_p99_ns,lock_free_linked_list_ops_per_second,"
+               "lock_free_linked_list_p99_ns,lock_free_array_ops_per_second,lock_free_array_p99_ns"
+            << std::endl;
+  for (auto threads : threadCounts)
+  {
+    auto mutex = run<MutexStack>(threads, seconds);
+    auto lockFree = run<StackLockFreeLinkedList>(threads, seconds);
+    auto bounded = run<BoundedStack>(threads, seconds);
+    std::cout << threads << "," << mutex.operationsPerSecond << "," << mutex.p99Nanoseconds << ","
+              << lockFree.operationsPerSecond << "," << lockFree.p99Nanoseconds << "," << bounded.operationsPerSecond
+              << "," << bounded.p99Nanoseconds << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,480 @@
+/*
+  Benchmarks | Container Suite
+
+  Measures the six containers (`DynamicArray`, `StackStaticArray`,
+  `StackDynamicArray`, `StackDoublyLinkedList`, `SinglyLinkedList`,
+  `DoublyLinkedList`) over the same workloads and sizes. Use it to pick a
+  structure for a workload and to spot regressions between commits.
+
+  | Operation | What is timed                                                |
+  | push      | `append`/`push` of `size` elements into an empty container   |
+  | pop       | `delete_at(size - 1)`/`pop`/`removeTail` down to one element |
+  | access    | `at(i)` at random indices                                    |
+  | insert    | `insert_at`/`insertAt` in the middle                         |
+  | remove    | `delete_at`/`removeAt` in the middle                         |
+  | search    | `indexOf` of a value that is not present                     |
+
+  Operations that cost O(n) each (access on lists, insert, remove, search)
+  run `clamp(10^8 / size, 1, 1000)` times, so large sizes stay tractable.
+  Operations a container does not offer are skipped.
+
+  Every case runs in a forked child process, so its peak RSS is its own.
+  Each case reports ns per operation, allocator calls per operation and
+  peak RSS in KiB. Allocator calls are counted by `AllocationCounter.hpp`.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/ContainerBenchmarks.cpp -o containers
+    ./containers [--json] [--max-size N] [--only CONTAINER]
+
+  Sizes run over the powers of ten from 10 to `--max-size` (default 10^6; up to 10^8).
+*/
+
+// The container files are included into their own namespaces, because the
+// list and stack files each define a `Node` class. Everything they include is
+// pulled in here first, so their include guards keep it at global scope.
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../data-structures/common/Allocation.hpp"
+#include "../data-structures/common/GrowthPolicy.hpp"
+#include "../data-structures/common/NodePool.hpp"
+#include "../data-structures/common/SimdSearch.hpp"
+#include "../data-structures/common/Snapshot.hpp"
+#include "../data-structures/common/ThreadPool.hpp"
+#include "AllocationCounter.hpp"
+
+#define DSA_NO_MAIN
+namespace dynamicArray
+{
+#include "../data-structures/dynamic-array/DynamicArray.cpp"
+}
+namespace stackStaticArray
+{
+#include "../data-structures/stacks/StackStaticArray.cpp"
+}
+namespace stackDynamicArray
+{
+#include "../data-structures/stacks/StackDynamicArray.cpp"
+}
+namespace stackDoublyLinkedList
+{
+#include "../data-structures/stacks/StackDoublyLinkedList.cpp"
+}
+namespace singlyLinkedList
+{
+#include "../data-structures/linked-lists/SinglyLinkedList.cpp"
+}
+namespace doublyLinkedList
+{
+#include "../data-structures/linked-lists/DoublyLinkedList.cpp"
+}
+
+typedef unsigned int uint;
+
+class Stopwatch
+{
+private:
+  std::chrono::steady_clock::time_point _start;
+  unsigned long long _allocationsAtStart;
+
+public:
+  double nanoseconds;
+  unsigned long long allocations;
+
+  void start()
+  {
+    this->_allocationsAtStart = allocations::count;
+    this->_start = std::chrono::steady_clock::now();
+  }
+
+  void stop()
+  {
+    this->nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - this->_start).count();
+    this->allocations = allocations::count - this->_allocationsAtStart;
+  }
+};
+
+class Random
+{
+private:
+  unsigned long long _state = 88172645463325252ull;
+
+public:
+  uint below(uint bound)
+  {
+    this->_state ^= this->_state << 13;
+    this->_state ^= this->_state >> 7;
+    this->_state ^= this->_state << 17;
+    return (uint)(this->_state % bound);
+  }
+};
+
+// Keeps the compiler from discarding reads whose results are otherwise unused.
+volatile long long sink;
+
+uint linearOperations(uint size)
+{
+  auto operations = 100000000u / size;
+  if (operations < 1) return 1;
+  return operations > 1000 ? 1000 : operations;
+}
+
+// Each workload fills `stopwatch` and returns how many operations it timed, or 0 when the container lacks it.
+template <typename Container>
+struct Workloads;
+
+template <>
+struct Workloads<dynamicArray::DynamicArray<int>>
+{
+  typedef dynamicArray::DynamicArray<int> Container;
+  static void fill(Container &container, uint size) { for (uint i = 0; i < size; i++) container.append(i); }
+
+  static uint push(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    stopwatch.start();
+    fill(container, size);
+    stopwatch.stop();
+    return size;
+  }
+
+  static uint pop(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    fill(container, size);
+    stopwatch.start();
+    while (container.size() > 1) container.delete_at(container.size() - 1);
+    stopwatch.stop();
+    return size - 1;
+  }
+
+  static uint access(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    fill(container, size);
+    Random random;
+    long long sum = 0;
+    stopwatch.start();
+    for (uint i = 0; i < size; i++) sum += container.at(random.below(size));
+    stopwatch.stop();
+    sink = sum;
+    return size;
+  }
+
+  static uint insert(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    fill(container, size);
+    auto operations = linearOperations(size);
+    stopwatch.start();
+    for (uint i = 0; i < operations; i++) container.insert_at(container.size() / 2, i);
+    stopwatch.stop();
+    return operations;
+  }
+
+  static uint remove(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    fill(container, size);
+    auto operations = std::min(linearOperations(size), size - 1);
+    stopwatch.start();
+    for (uint i = 0; i < operations; i++) container.delete_at(container.size() / 2);
+    stopwatch.stop();
+    return operations;
+  }
+
+  static uint search(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    fill(container, size);
+    auto operations = linearOperations(size);
+    long long found = 0;
+    stopwatch.start();
+    for (uint i = 0; i < operations; i++) found += container.indexOf(-1);
+    stopwatch.stop();
+    sink = found;
+    return operations;
+  }
+};
+
+// The three stacks share push/pop/search; only construction differs.
+template <typename Container>
+struct StackWorkloads
+{
+  static void fill(Container &container, uint size) { for (uint i = 0; i < size; i++) container.push(i); }
+
+  static uint push(uint size, Stopwatch &stopwatch)
+  {
+    auto *container = Workloads<Container>::create(size);
+    stopwatch.start();
+    fill(*container, size);
+    stopwatch.stop();
+    delete container;
+    return size;
+  }
+
+  static uint pop(uint size, Stopwatch &stopwatch)
+  {
+    auto *container = Workloads<Container>::create(size);
+    fill(*container, size);
+    long long sum = 0;
+    stopwatch.start();
+    while (container->size() > 1) sum += container->pop();
+    stopwatch.stop();
+    sink = sum;
+    delete container;
+    return size - 1;
+  }
+
+  static uint access(uint, Stopwatch &) { return 0; }
+  static uint insert(uint, Stopwatch &) { return 0; }
+  static uint remove(uint, Stopwatch &) { return 0; }
+
+  static uint search(uint size, Stopwatch &stopwatch)
+  {
+    auto *container = Workloads<Container>::create(size);
+    fill(*container, size);
+    auto operations = linearOperations(size);
+    long long found = 0;
+    stopwatch.start();
+    for (uint i = 0; i < operations; i++) found += container->indexOf(-1);
+    stopwatch.stop();
+    sink = found;
+    delete container;
+    return operations;
+  }
+};
+
+template <>
+struct Workloads<stackStaticArray::StackStaticArray<>> : StackWorkloads<stackStaticArray::StackStaticArray<>>
+{
+  static stackStaticArray::StackStaticArray<> *create(uint size) { return new stackStaticArray::StackStaticArray<>(size); }
+};
+
+template <>
+struct Workloads<stackDynamicArray::StackDynamicArray<>> : StackWorkloads<stackDynamicArray::StackDynamicArray<>>
+{
+  static stackDynamicArray::StackDynamicArray<> *create(uint) { return new stackDynamicArray::StackDynamicArray<>(); }
+};
+
+template <>
+struct Workloads<stackDoublyLinkedList::StackDoublyLinkedList> : StackWorkloads<stackDoublyLinkedList::StackDoublyLinkedList>
+{
+  static stackDoublyLinkedList::StackDoublyLinkedList *create(uint) { return new stackDoublyLinkedList::StackDoublyLinkedList(); }
+};
+
+// The two lists share the same API.
+template <typename Container>
+struct ListWorkloads
+{
+  static void fill(Container &container, uint size) { for (uint i = 0; i < size; i++) container.append(i); }
+
+  static uint push(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    stopwatch.start();
+    fill(container, size);
+    stopwatch.stop();
+    return size;
+  }
+
+  static uint pop(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    fill(container, size);
+    auto operations = size - 1;
+    // SinglyLinkedList::removeTail walks the whole list, so cap it like the other O(n) operations.
+    if (std::is_same<Container, singlyLinkedList::SinglyLinkedList>::value) operations = std::min(operations, linearOperations(size));
+    stopwatch.start();
+    for (uint i = 0; i < operations; i++) container.removeTail();
+    stopwatch.stop();
+    return operations;
+  }
+
+  static uint access(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    fill(container, size);
+    Random random;
+    auto operations = linearOperations(size);
+    long long sum = 0;
+    stopwatch.start();
+    for (uint i = 0; i < operations; i++) sum += container.at(random.below(size));
+    stopwatch.stop();
+    sink = sum;
+    return operations;
+  }
+
+  static uint insert(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    fill(container, size);
+    auto operations = linearOperations(size);
+    stopwatch.start();
+    for (uint i = 0; i < operations; i++) container.insertAt(container.size() / 2, i);
+    stopwatch.stop();
+    return operations;
+  }
+
+  static uint remove(uint size, Stopwatch &stopwatch)
+  {
+    Container container;
+    fill(container, size);
+    auto operations = std::min(linearOperations(size), size > 2 ? size - 2 : 0);
+    stopwatch.start();
+    for (uint i = 0; i < operations; i++) container.removeAt(container.size() / 2);
+    stopwatch.stop();
+    return operations;
+  }
+
+  static uint search(uint, Stopwatch &) { return 0; }
+};
+
+template <>
+struct Workloads<singlyLinkedList::SinglyLinkedList> : ListWorkloads<singlyLinkedList::SinglyLinkedList>
+{
+};
+
+template <>
+struct Workloads<doublyLinkedList::DoublyLinkedList> : ListWorkloads<doublyLinkedList::DoublyLinkedList>
+{
+};
+
+class Suite
+{
+private:
+  bool _isJson;
+  bool _isFirstResult;
+  std::string _only;
+
+  void _report(const char *container, const char *operation, uint size, uint operations, Stopwatch &stopwatch)
+  {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    auto nanosecondsPerOperation = stopwatch.nanoseconds / operations;
+    auto allocationsPerOperation = (double)stopwatch.allocations / operations;
+    if (this->_isJson)
+      std::cout << "  {\"container\": \"" << container << "\", \"operation\": \"" << operation << "\", \"size\": " << size
+                << ", \"operations\": " << operations << ", \"ns_per_op\": " << nanosecondsPerOperation
+                << ", \"allocations_per_op\": " << allocationsPerOperation << ", \"peak_rss_kib\": " << usage.ru_maxrss << "}";
+    else
+      std::cout << container << "," << operation << "," << size << "," << operations << "," << nanosecondsPerOperation << ","
+                << allocationsPerOperation << "," << usage.ru_maxrss << std::endl;
+  }
+
+  template <typename Workload>
+  void _run(const char *container, const char *operation, uint size, Workload workload)
+  {
+    if (!this->_only.empty() && this->_only != container) return;
+    std::cout.flush();
+    auto child = fork();
+    if (child == 0)
+    {
+      Stopwatch stopwatch;
+      auto operations = workload(size, stopwatch);
+      if (operations > 0)
+      {
+        if (this->_isJson && !this->_isFirstResult) std::cout << "," << std::endl;
+        this->_report(container, operation, size, operations, stopwatch);
+      }
+      std::cout.flush();
+      _exit(operations > 0 ? 0 : 1);
+    }
+    int status = 0;
+    waitpid(child, &status, 0);
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) this->_isFirstResult = false;
+  }
+
+  template <typename Container>
+  void _runAll(const char *container, uint size)
+  {
+    this->_run(container, "push", size, Workloads<Container>::push);
+    this->_run(container, "pop", size, Workloads<Container>::pop);
+    this->_run(container, "access", size, Workloads<Container>::access);
+    this->_run(container, "insert", size, Workloads<Container>::insert);
+    this->_run(container, "remove", size, Workloads<Container>::remove);
+    this->_run(container, "search", size, Workloads<Container>::search);
+  }
+
+public:
+  Suite(bool isJson, const std::string &only)
+  {
+    this->_isJson = isJson;
+    this->_isFirstResult = true;
+    this->_only = only;
+  }
+
+  void run(uint maxSize)
+  {
+    if (this->_isJson) std::cout << "[" << std::endl;
+    else std::cout << "container,operation,size,operations,ns_per_op,allocations_per_op,peak_rss_kib" << std::endl;
+    for (unsigned long long size = 10; size <= maxSize; size *= 10)
+    {
+      this->_runAll<dynamicArray::DynamicArray<int>>("DynamicArray", size);
+      this->_runAll<stackStaticArray::StackStaticArray<>>("StackStaticArray", size);
+      this->_runAll<stackDynamicArray::StackDynamicArray<>>("StackDynamicArray", size);
+      this->_runAll<stackDoublyLinkedList::StackDoublyLinkedList>("StackDoublyLinkedList", size);
+      this->_runAll<singlyLinkedList::SinglyLinkedList>("SinglyLinkedList", size);
+      this->_runAll<doublyLinkedList::DoublyLinkedList>("DoublyLinkedList", size);
+    }
+    if (this->_isJson) std::cout << std::endl << "]" << std::endl;
+  }
+};
+
+int main(int argc, char **argv)
+{
+  bool isJson = false;
+  uint maxSize = 1000000;
+  std::string only;
+
+  for (int i = 1; i < argc; i++)
+  {
+    std::string argument = argv[i];
+    if (argument == "--json") isJson = true;
+    else if (argument == "--max-size" && i + 1 < argc) maxSize = std::stoul(argv[++i]);
+    else if (argument == "--only" && i + 1 < argc) only = argv[++i];
+    else
+    {
+      std::cerr << "Usage: " << argv[0] << " [--json] [--max-size N] [--only CONTAINER]" << std::endl;
+      return 1;
+    }
+  }
+
+  // The lists take their nodes from `NodePool` slabs. If the counter missed those allocations, every list
+  // case would report zero allocations per operation.
+  {
+    doublyLinkedList::DoublyLinkedList list;
+    auto allocationsBefore = allocations::count;
+    list.append(0);
+    if (allocations::count == allocationsBefore)
+    {
+      std::cerr << "The allocation counter does not see node pool slabs." << std::endl;
+      return 1;
+    }
+  }
+
+  Suite suite(isJson, only);
+  suite.run(maxSize);
+
+  return 0;
+}
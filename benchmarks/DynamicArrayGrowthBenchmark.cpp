@@ -0,0 +1,62 @@
+/*
+  Benchmarks | Dynamic Array Growth
+
+  Compares the cost of growing a `DynamicArray` through repeated appends when
+  the element type is trivially copyable (single `realloc`) against a type with
+  a user-provided copy constructor (per-element move loop into a new buffer).
+  Both element types hold one `int`, so the only difference is the growth path.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/DynamicArrayGrowthBenchmark.cpp -o growth && ./growth
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/dynamic-array/DynamicArray.cpp"
+
+#include <chrono>
+
+struct LoopCopiedInt
+{
+  int value;
+
+  LoopCopiedInt(int value) : value(value) {}
+  LoopCopiedInt(const LoopCopiedInt &other) : value(other.value) {}
+  LoopCopiedInt &operator=(const LoopCopiedInt &other)
+  {
+    this->value = other.value;
+    return *this;
+  }
+};
+
+template <typename T>
+double appendNanosecondsPerOp(unsigned int count, unsigned int rounds)
+{
+  long long checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int round = 0; round < rounds; round++)
+  {
+    DynamicArray<T> arr;
+    for (unsigned int i = 0; i < count; i++) arr.append(T(i));
+    checksum += arr.size();
+  }
+  auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  if (checksum != (long long)count * rounds) std::cerr << "checksum mismatch" << std::endl;
+  return elapsed / ((double)count * rounds);
+}
+
+int main()
+{
+  unsigned int counts[] = {1000, 100000, 10000000};
+
+  std::cout << "elements,trivially_copyable_ns_per_append,per_element_loop_ns_per_append,speedup" << std::endl;
+  for (auto count : counts)
+  {
+    auto rounds = 20000000 / count;
+    if (rounds == 0) rounds = 1;
+    auto trivial = appendNanosecondsPerOp<int>(count, rounds);
+    auto loop = appendNanosecondsPerOp<LoopCopiedInt>(count, rounds);
+    std::cout << count << "," << trivial << "," << loop << "," << loop / trivial << std::endl;
+  }
+
+  return 0;
+}
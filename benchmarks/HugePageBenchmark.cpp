@@ -0,0 +1,110 @@
+/*
+  Benchmarks | Huge Page Allocation
+
+  Fills a large `DynamicArray<int>` and then reads it at random indices,
+  once with `DefaultAllocation` and once with `CacheAlignedAllocation`. The
+  random reads make the TLB the bottleneck. The benchmark reports ns per
+  read and the dTLB read misses counted by `perf_event_open`. The miss
+  column shows `n/a` when the kernel does not allow the counter, for
+  example under a high `perf_event_paranoid` or inside a container.
+
+  Build and run (optional argument: number of elements, default 2^28 = 1 GiB):
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/HugePageBenchmark.cpp -o hugepages && ./hugepages [elements]
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/dynamic-array/DynamicArray.cpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+class DtlbMissCounter
+{
+private:
+  int _fileDescriptor;
+
+public:
+  DtlbMissCounter()
+  {
+    perf_event_attr attributes;
+    std::memset(&attributes, 0, sizeof(attributes));
+    attributes.size = sizeof(attributes);
+    attributes.type = PERF_TYPE_HW_CACHE;
+    attributes.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    this->_fileDescriptor = syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+  }
+
+  ~DtlbMissCounter()
+  {
+    if (this->_fileDescriptor != -1) close(this->_fileDescriptor);
+  }
+
+  bool available() { return this->_fileDescriptor != -1; }
+
+  void start()
+  {
+    if (!this->available()) return;
+    ioctl(this->_fileDescriptor, PERF_EVENT_IOC_RESET, 0);
+    ioctl(this->_fileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+  }
+
+  long long stop()
+  {
+    if (!this->available()) return -1;
+    ioctl(this->_fileDescriptor, PERF_EVENT_IOC_DISABLE, 0);
+    long long count = 0;
+    if (read(this->_fileDescriptor, &count, sizeof(count)) != sizeof(count)) return -1;
+    return count;
+  }
+};
+
+template <typename Allocation>
+void randomReads(const char *name, unsigned int elements, unsigned int reads)
+{
+  DynamicArray<int, DoublingGrowth, Allocation> arr;
+  arr.reserve(elements);
+  for (unsigned int i = 0; i < elements; i++) arr.append(i);
+
+  DtlbMissCounter counter;
+  uint64_t state = 88172645463325252ull;
+  long long checksum = 0;
+
+  counter.start();
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < reads; i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    checksum += arr.at(state % elements);
+  }
+  auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  auto misses = counter.stop();
+
+  std::cout << name << "," << elements << "," << elapsed / reads << ",";
+  if (misses < 0) std::cout << "n/a";
+  else std::cout << (double)misses / reads;
+  std::cout << "," << (((uintptr_t)&arr.at(0)) % 64 == 0 ? "yes" : "no") << std::endl;
+  if (checksum == 42) std::cerr << "unlikely checksum" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+  unsigned int elements = argc > 1 ? std::stoul(argv[1]) : 1u << 28;
+  unsigned int reads = 20000000;
+
+  std::cout << "allocation,elements,ns_per_read,dtlb_misses_per_read,cache_line_aligned" << std::endl;
+  randomReads<DefaultAllocation>("default", elements, reads);
+  randomReads<CacheAlignedAllocation>("cache_aligned_huge_pages", elements, reads);
+
+  return 0;
+}
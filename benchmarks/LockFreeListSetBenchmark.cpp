@@ -0,0 +1,129 @@
+/*
+  Benchmarks | Lock-Free List Set
+
+  Every thread runs a random mix of `insert`, `remove` and `contains` on
+  one shared set of keys below 1024, half of them present at the start,
+  for a fixed time. A sorted `std::forward_list` behind a `std::mutex`,
+  the global lock the lock-free set replaces, is the baseline. Two mixes
+  are timed: read-mostly (90% `contains`) and update-heavy (50%
+  `contains`, the rest split between `insert` and `remove`). Throughput is
+  in completed operations per second across all threads. Scaling only
+  shows with as many cores as threads; the first line reports how many
+  the machine has, and thread counts above it measure oversubscription.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG -pthread benchmarks/LockFreeListSetBenchmark.cpp -o lockfreelistset && ./lockfreelistset
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/linked-lists/LockFreeListSet.cpp"
+
+#include <chrono>
+#include <forward_list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class MutexListSet
+{
+private:
+  std::forward_list<int> _list;
+  std::mutex _mutex;
+
+  // The last element less than `data`, or the position before the first.
+  std::forward_list<int>::iterator _before(int data)
+  {
+    auto previous = this->_list.before_begin();
+    for (auto current = this->_list.begin(); current != this->_list.end() && *current < data; ++current) previous = current;
+    return previous;
+  }
+
+public:
+  bool insert(int data)
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    auto previous = this->_before(data);
+    auto next = std::next(previous);
+    if (next != this->_list.end() && *next == data) return false;
+    this->_list.insert_after(previous, data);
+    return true;
+  }
+
+  bool remove(int data)
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    auto previous = this->_before(data);
+    auto next = std::next(previous);
+    if (next == this->_list.end() || *next != data) return false;
+    this->_list.erase_after(previous);
+    return true;
+  }
+
+  bool contains(int data)
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    auto next = std::next(this->_before(data));
+    return next != this->_list.end() && *next == data;
+  }
+};
+
+const unsigned int keys = 1024;
+
+volatile unsigned long long sink;
+
+template <typename Set>
+double run(unsigned int threads, unsigned int containsPercent, double seconds)
+{
+  Set set;
+  for (unsigned int key = 0; key < keys; key += 2) set.insert(key);
+  std::atomic<bool> isRunning(true);
+  std::vector<unsigned long long> operations(threads, 0);
+  std::vector<std::thread> workers;
+  for (unsigned int t = 0; t < threads; t++)
+  {
+    workers.emplace_back([&, t] {
+      unsigned int seed = 2 * t + 1;
+      unsigned long long count = 0, found = 0;
+      while (isRunning.load(std::memory_order_relaxed))
+      {
+        seed = seed * 1103515245 + 12345;
+        auto key = (int)((seed >> 8) % keys);
+        auto choice = (seed >> 20) % 100;
+        if (choice < containsPercent) found += set.contains(key);
+        else if ((choice & 1) == 0) found += set.insert(key);
+        else found += set.remove(key);
+        count++;
+      }
+      operations[t] = count;
+      sink = found;
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+  isRunning.store(false);
+  for (auto &worker : workers) worker.join();
+  unsigned long long total = 0;
+  for (auto count : operations) total += count;
+  return total / seconds;
+}
+
+int main()
+{
+  unsigned int threadCounts[] = {1, 2, 4, 8, 16};
+  unsigned int containsPercents[] = {90, 50};
+  double seconds = 0.5;
+
+  std::cout << "hardware_threads," << std::thread::hardware_concurrency() << std::endl;
+  std::cout << "contains_percent,threads,mutex_ops_per_second,lock_free_ops_per_second,speedup" << std::endl;
+  for (auto containsPercent : containsPercents)
+  {
+    for (auto threads : threadCounts)
+    {
+      auto mutex = run<MutexListSet>(threads, containsPercent, seconds);
+      auto lockFree = run<LockFreeListSet>(threads, containsPercent, seconds);
+      std::cout << containsPercent << "," << threads << "," << mutex << "," << lockFree << "," << lockFree / mutex
+                << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+/*
+  Benchmarks | Node Pool
+
+  Churns a `DoublyLinkedList` by removing from the head and appending at the
+  tail, which keeps the size fixed. The pooled list is timed against the
+  allocation path the lists used before `NodePool`: one `new Node` per
+  insert and one `delete` per removal, with identical linking code. A
+  second pair of runs churns two lists that share one pool.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/NodePoolBenchmark.cpp -o nodepool && ./nodepool
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/linked-lists/DoublyLinkedList.cpp"
+
+#include <chrono>
+
+// The append/removeHead path of DoublyLinkedList with plain new/delete.
+class HeapChurnList
+{
+private:
+  Node *_headPtr = nullptr;
+  Node *_tailPtr = nullptr;
+
+public:
+  ~HeapChurnList()
+  {
+    while (this->_headPtr != nullptr) this->removeHead();
+  }
+
+  void append(int data)
+  {
+    auto *newNodePtr = new Node(data);
+    if (this->_tailPtr == nullptr) this->_headPtr = newNodePtr;
+    else
+    {
+      this->_tailPtr->nextPtr = newNodePtr;
+      newNodePtr->previousPtr = this->_tailPtr;
+    }
+    this->_tailPtr = newNodePtr;
+  }
+
+  void removeHead()
+  {
+    auto *tempNodePtr = this->_headPtr;
+    this->_headPtr = this->_headPtr->nextPtr;
+    if (this->_headPtr == nullptr) this->_tailPtr = nullptr;
+    else this->_headPtr->previousPtr = nullptr;
+    delete tempNodePtr;
+  }
+};
+
+template <typename List>
+double churnOperationsPerSecond(List &first, List &second, unsigned int size, unsigned int operations)
+{
+  for (unsigned int i = 0; i < size; i++)
+  {
+    first.append(i);
+    second.append(i);
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < operations; i++)
+  {
+    auto &list = (i & 1) ? first : second;
+    list.removeHead();
+    list.append(i);
+  }
+  auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return operations / seconds;
+}
+
+int main()
+{
+  unsigned int sizes[] = {100, 10000, 1000000};
+  unsigned int operations = 20000000;
+
+  std::cout << "size,heap_ops_per_second,pooled_ops_per_second,shared_pool_ops_per_second" << std::endl;
+  for (auto size : sizes)
+  {
+    HeapChurnList heapFirst, heapSecond;
+    auto heap = churnOperationsPerSecond(heapFirst, heapSecond, size, operations);
+
+    DoublyLinkedList pooledFirst, pooledSecond;
+    auto pooled = churnOperationsPerSecond(pooledFirst, pooledSecond, size, operations);
+
+    auto poolPtr = std::make_shared<NodePool<Node>>();
+    DoublyLinkedList sharedFirst(poolPtr), sharedSecond(poolPtr);
+    auto shared = churnOperationsPerSecond(sharedFirst, sharedSecond, size, operations);
+
+    std::cout << size << "," << heap << "," << pooled << "," << shared << std::endl;
+  }
+
+  return 0;
+}
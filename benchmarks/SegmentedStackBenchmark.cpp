@@ -0,0 +1,78 @@
+/*
+  Benchmarks | Segmented Stack
+
+  Pushes `size` elements onto a `StackDynamicArray` and a
+  `StackSegmentedArray`, timing every push on its own. The dynamic array's
+  slowest push is the one that copies the whole stack into a larger
+  buffer; the segmented stack never copies, so its slowest push is bounded
+  by one chunk allocation. With the default allocation a large buffer is
+  grown by `realloc`, which glibc can serve by remapping pages instead of
+  copying, so `CacheAlignedAllocation` is timed too. Each run is
+  forked so that its peak RSS is its own.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/SegmentedStackBenchmark.cpp -o segmentedstack && ./segmentedstack
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/stacks/StackDynamicArray.cpp"
+#include "../data-structures/stacks/StackSegmentedArray.cpp"
+
+#include <algorithm>
+#include <chrono>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+template <typename Stack>
+void measure(const char *container, unsigned int size)
+{
+  typedef std::chrono::steady_clock Clock;
+  Stack stack;
+  double slowestNanoseconds = 0;
+  unsigned int slowPushes = 0;
+  auto start = Clock::now();
+  for (unsigned int i = 0; i < size; i++)
+  {
+    auto pushStart = Clock::now();
+    stack.push(i);
+    auto nanoseconds = std::chrono::duration<double, std::nano>(Clock::now() - pushStart).count();
+    slowestNanoseconds = std::max(slowestNanoseconds, nanoseconds);
+    slowPushes += nanoseconds > 100000;
+  }
+  auto totalMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  std::cout << container << "," << size << "," << totalMilliseconds << "," << slowestNanoseconds / 1000 << ","
+            << slowPushes << "," << usage.ru_maxrss << std::endl;
+}
+
+template <typename Stack>
+void inChild(const char *container, unsigned int size)
+{
+  std::cout.flush();
+  auto child = fork();
+  if (child == 0)
+  {
+    measure<Stack>(container, size);
+    std::cout.flush();
+    _exit(0);
+  }
+  int status = 0;
+  waitpid(child, &status, 0);
+}
+
+int main()
+{
+  unsigned int sizes[] = {1000000, 10000000, 100000000};
+
+  std::cout << "container,size,total_ms,slowest_push_us,pushes_over_100us,peak_rss_kib" << std::endl;
+  for (auto size : sizes)
+  {
+    inChild<StackDynamicArray<>>("StackDynamicArray", size);
+    inChild<StackDynamicArray<DoublingGrowth, CacheAlignedAllocation>>("StackDynamicArray<CacheAligned>", size);
+    inChild<StackSegmentedArray<>>("StackSegmentedArray", size);
+  }
+
+  return 0;
+}
@@ -0,0 +1,59 @@
+/*
+  Benchmarks | Small Dynamic Array
+
+  Builds, reads and destroys many short-lived arrays of a few elements, once
+  with `DynamicArray` and once with `SmallDynamicArray<int, 16>`. It reports
+  time per array and allocator calls per array, so the effect of keeping
+  small arrays inline is visible both in heap traffic and in cache behaviour.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/SmallDynamicArrayBenchmark.cpp -o small && ./small
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/dynamic-array/DynamicArray.cpp"
+#include "../data-structures/dynamic-array/SmallDynamicArray.cpp"
+#include "AllocationCounter.hpp"
+
+#include <chrono>
+
+struct Result
+{
+  double nanosecondsPerArray;
+  double allocationsPerArray;
+};
+
+template <typename Array>
+Result buildShortLivedArrays(unsigned int elements, unsigned int arrays)
+{
+  long long checksum = 0;
+  auto allocationsBefore = allocations::count;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int round = 0; round < arrays; round++)
+  {
+    Array arr;
+    for (unsigned int i = 0; i < elements; i++) arr.append(round + i);
+    for (unsigned int i = 0; i < elements; i++) checksum += arr.at(i);
+  }
+  auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  auto allocationCalls = allocations::count - allocationsBefore;
+  if (checksum == 42) std::cerr << "unlikely checksum" << std::endl;
+  return {elapsed / arrays, (double)allocationCalls / arrays};
+}
+
+int main()
+{
+  unsigned int sizes[] = {1, 4, 8, 16, 32};
+  unsigned int arrays = 2000000;
+
+  std::cout << "elements,dynamic_ns_per_array,dynamic_allocations_per_array,small_ns_per_array,small_allocations_per_array" << std::endl;
+  for (auto elements : sizes)
+  {
+    auto dynamic = buildShortLivedArrays<DynamicArray<int>>(elements, arrays);
+    auto small = buildShortLivedArrays<SmallDynamicArray<int, 16>>(elements, arrays);
+    std::cout << elements << "," << dynamic.nanosecondsPerArray << "," << dynamic.allocationsPerArray << ","
+              << small.nanosecondsPerArray << "," << small.allocationsPerArray << std::endl;
+  }
+
+  return 0;
+}
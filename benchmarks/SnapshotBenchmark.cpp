@@ -0,0 +1,102 @@
+/*
+  Benchmarks | Snapshot
+
+  Saves and restores `size` elements through each container's binary
+  snapshot and reports the time and throughput of both directions. As a
+  baseline, the same `DynamicArray` is written as text, one element per
+  `<<`, and parsed back, which is what persisting through `toString()`
+  amounts to. Snapshot saves include the `fsync` that makes them durable;
+  the text baseline does not sync. The restores read a file that is still in the page cache;
+  drop the cache between save and load to measure the disk instead.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/SnapshotBenchmark.cpp -o snapshot && ./snapshot [directory]
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/dynamic-array/DynamicArray.cpp"
+#include "../data-structures/stacks/StackDynamicArray.cpp"
+#include "../data-structures/linked-lists/DoublyLinkedList.cpp"
+
+#include <chrono>
+#include <fstream>
+
+template <typename Function>
+double milliseconds(Function function)
+{
+  typedef std::chrono::steady_clock Clock;
+  auto start = Clock::now();
+  function();
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void report(const char *container, const char *format, unsigned int size, double saveMilliseconds,
+            double loadMilliseconds)
+{
+  auto megabytes = (double)size * sizeof(int) / (1 << 20);
+  std::cout << container << "," << format << "," << size << "," << saveMilliseconds << "," << loadMilliseconds << ","
+            << megabytes / (saveMilliseconds / 1000) << "," << megabytes / (loadMilliseconds / 1000) << std::endl;
+}
+
+template <typename Container, typename Fill, typename Check>
+void measure(const char *container, const std::string &path, unsigned int size, Fill fill, Check check)
+{
+  Container saved;
+  fill(saved, size);
+  auto saveMilliseconds = milliseconds([&] { saved.saveSnapshot(path); });
+  Container restored;
+  auto loadMilliseconds = milliseconds([&] { restored.loadSnapshot(path); });
+  if (!check(restored, size)) std::cout << container << " restored different elements" << std::endl;
+  report(container, "snapshot", size, saveMilliseconds, loadMilliseconds);
+  unlink(path.c_str());
+}
+
+int main(int argc, char **argv)
+{
+  std::string directory = argc > 1 ? argv[1] : "/tmp";
+  auto path = directory + "/SnapshotBenchmark.bin";
+  unsigned int sizes[] = {1 << 20, 1 << 24};
+
+  std::cout << "container,format,size,save_ms,load_ms,save_mib_per_s,load_mib_per_s" << std::endl;
+  for (auto size : sizes)
+  {
+    measure<DynamicArray<int>>(
+        "DynamicArray", path, size,
+        [](DynamicArray<int> &array, unsigned int count) {
+          for (unsigned int i = 0; i < count; i++) array.append(i);
+        },
+        [](DynamicArray<int> &array, unsigned int count) {
+          return array.size() == count && array.at(count - 1) == (int)count - 1;
+        });
+    measure<StackDynamicArray<>>(
+        "StackDynamicArray", path, size,
+        [](StackDynamicArray<> &stack, unsigned int count) {
+          for (unsigned int i = 0; i < count; i++) stack.push(i);
+        },
+        [](StackDynamicArray<> &stack, unsigned int count) { return stack.size() == count && stack.top() == (int)count - 1; });
+    measure<DoublyLinkedList>(
+        "DoublyLinkedList", path, size,
+        [](DoublyLinkedList &list, unsigned int count) {
+          for (unsigned int i = 0; i < count; i++) list.append(i);
+        },
+        [](DoublyLinkedList &list, unsigned int count) { return list.size() == count && list.atTail() == (int)count - 1; });
+
+    DynamicArray<int> saved;
+    for (unsigned int i = 0; i < size; i++) saved.append(i);
+    auto saveMilliseconds = milliseconds([&] {
+      std::ofstream output(path);
+      for (unsigned int i = 0; i < saved.size(); i++) output << saved.at(i) << '\n';
+    });
+    DynamicArray<int> restored;
+    auto loadMilliseconds = milliseconds([&] {
+      std::ifstream input(path);
+      int element;
+      while (input >> element) restored.append(element);
+    });
+    if (restored.size() != size) std::cout << "DynamicArray restored different elements from text" << std::endl;
+    report("DynamicArray", "text", size, saveMilliseconds, loadMilliseconds);
+    unlink(path.c_str());
+  }
+
+  return 0;
+}
@@ -0,0 +1,71 @@
+/*
+  Benchmarks | Treap List
+
+  Times positional access and insertion at random indices on a
+  `DoublyLinkedList` and a `TreapList` of the same size. The linked list
+  walks from the head on every call; the treap descends from its root.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/TreapListBenchmark.cpp -o treaplist && ./treaplist
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/linked-lists/DoublyLinkedList.cpp"
+#include "../data-structures/linked-lists/TreapList.cpp"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+template <typename List>
+double accessesPerSecond(List &list, unsigned int operations)
+{
+  std::mt19937 random(1);
+  volatile int sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < operations; i++) sink = sink + list.at(random() % list.size());
+  auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return operations / seconds;
+}
+
+template <typename List>
+double insertsPerSecond(List &list, unsigned int operations)
+{
+  std::mt19937 random(2);
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < operations; i++) list.insertAt(random() % list.size(), i);
+  auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return operations / seconds;
+}
+
+int main()
+{
+  unsigned int sizes[] = {1000, 10000, 100000, 1000000};
+
+  std::cout << "size,list_accesses_per_second,treap_accesses_per_second,list_inserts_per_second,treap_inserts_per_second"
+            << std::endl;
+  for (auto size : sizes)
+  {
+    // Capped at `size` so the inserts at most double the list.
+    auto listOperations = std::min(100000000 / size, size);
+    auto treapOperations = std::min(1000000u, size);
+
+    DoublyLinkedList list;
+    TreapList treap;
+    for (unsigned int i = 0; i < size; i++)
+    {
+      list.append(i);
+      treap.append(i);
+    }
+
+    auto listAccesses = accessesPerSecond(list, listOperations);
+    auto treapAccesses = accessesPerSecond(treap, treapOperations);
+    auto listInserts = insertsPerSecond(list, listOperations);
+    auto treapInserts = insertsPerSecond(treap, treapOperations);
+
+    std::cout << size << "," << listAccesses << "," << treapAccesses << "," << listInserts << "," << treapInserts
+              << std::endl;
+  }
+
+  return 0;
+}
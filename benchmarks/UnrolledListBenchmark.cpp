@@ -0,0 +1,68 @@
+/*
+  Benchmarks | Unrolled Doubly-Linked List
+
+  Times `at(size / 2)` on a `DoublyLinkedList` and an
+  `UnrolledDoublyLinkedList` holding the same elements. The middle index is
+  the farthest point from both ends, so each lookup is a traversal of half
+  the list. The unrolled list is filled twice: by appends, which leave its
+  nodes full, and by inserts at random positions, which leave them split.
+  Bytes per element counts node storage only.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/UnrolledListBenchmark.cpp -o unrolled && ./unrolled
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/linked-lists/DoublyLinkedList.cpp"
+#include "../data-structures/linked-lists/UnrolledDoublyLinkedList.cpp"
+
+#include <chrono>
+#include <random>
+
+template <typename List>
+double middleLookupsPerSecond(List &list, unsigned int lookups)
+{
+  volatile int sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < lookups; i++) sink = sink + list.at(list.size() / 2);
+  auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return lookups / seconds;
+}
+
+int main()
+{
+  typedef UnrolledDoublyLinkedList<> UnrolledList;
+  typedef UnrolledNode<27> UnrolledListNode;
+  unsigned int sizes[] = {1000, 10000, 100000};
+
+  std::cout << "size,list_lookups_per_second,unrolled_lookups_per_second,unrolled_random_lookups_per_second,"
+               "list_bytes_per_element,unrolled_bytes_per_element,unrolled_random_bytes_per_element"
+            << std::endl;
+  for (auto size : sizes)
+  {
+    auto lookups = 200000000 / size;
+    std::mt19937 random(size);
+
+    DoublyLinkedList list;
+    UnrolledList unrolled;
+    UnrolledList unrolledRandom;
+    for (unsigned int i = 0; i < size; i++)
+    {
+      list.append(i);
+      unrolled.append(i);
+      if (unrolledRandom.empty()) unrolledRandom.append(i);
+      else unrolledRandom.insertAt(random() % unrolledRandom.size(), i);
+    }
+
+    auto listRate = middleLookupsPerSecond(list, lookups);
+    auto unrolledRate = middleLookupsPerSecond(unrolled, lookups);
+    auto unrolledRandomRate = middleLookupsPerSecond(unrolledRandom, lookups);
+
+    std::cout << size << "," << listRate << "," << unrolledRate << "," << unrolledRandomRate << ","
+              << (double)sizeof(Node) << ","
+              << (double)unrolled.nodes() * sizeof(UnrolledListNode) / size << ","
+              << (double)unrolledRandom.nodes() * sizeof(UnrolledListNode) / size << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+/*
+  Benchmarks | Work Stealing
+
+  Runs two fork-join workloads on a `WorkStealingPool` with 1, 2, 4 and 8
+  threads: a recursive Fibonacci that spawns one task per call above a
+  serial cutoff, and a quicksort that spawns the left half of every
+  partition above a serial cutoff. The serial columns run the same
+  recursion without a pool. Speedup is against the pool with one thread.
+  The first line reports how many hardware threads the machine has;
+  thread counts above it cannot speed up and show the pool's overhead.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG -pthread benchmarks/WorkStealingBenchmark.cpp -o workstealing && ./workstealing
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/queues/WorkStealingDeque.cpp"
+
+#include <algorithm>
+#include <chrono>
+
+volatile long long sink;
+
+const int fibCutoff = 20;
+const unsigned int sortCutoff = 1 << 12;
+
+long long serialFib(int n) { return n < 2 ? n : serialFib(n - 1) + serialFib(n - 2); }
+
+long long parallelFib(WorkStealingPool &pool, int n)
+{
+  if (n < fibCutoff) return serialFib(n);
+  long long left = 0;
+  WorkStealingPool::TaskGroup group(pool);
+  group.spawn([&] { left = parallelFib(pool, n - 1); });
+  auto right = parallelFib(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+// Splits [first, last) into elements below, equal to and above the middle element, returning the bounds of
+// the equal run.
+std::pair<int *, int *> partition(int *first, int *last)
+{
+  auto pivot = first[(last - first) / 2];
+  auto *middle = std::partition(first, last, [pivot](int element) { return element < pivot; });
+  auto *upper = std::partition(middle, last, [pivot](int element) { return element == pivot; });
+  return {middle, upper};
+}
+
+void serialSort(int *first, int *last)
+{
+  if ((unsigned int)(last - first) < sortCutoff)
+  {
+    std::sort(first, last);
+    return;
+  }
+  auto bounds = partition(first, last);
+  serialSort(first, bounds.first);
+  serialSort(bounds.second, last);
+}
+
+void parallelSort(WorkStealingPool &pool, int *first, int *last)
+{
+  if ((unsigned int)(last - first) < sortCutoff)
+  {
+    std::sort(first, last);
+    return;
+  }
+  auto bounds = partition(first, last);
+  WorkStealingPool::TaskGroup group(pool);
+  group.spawn([&pool, first, bounds] { parallelSort(pool, first, bounds.first); });
+  parallelSort(pool, bounds.second, last);
+  group.wait();
+}
+
+std::vector<int> randomValues(unsigned int size)
+{
+  std::vector<int> values(size);
+  unsigned int seed = 12345;
+  for (auto &value : values)
+  {
+    seed = seed * 1103515245 + 12345;
+    value = (int)(seed >> 1);
+  }
+  return values;
+}
+
+template <typename Function>
+double milliseconds(Function function)
+{
+  typedef std::chrono::steady_clock Clock;
+  auto start = Clock::now();
+  function();
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+int main()
+{
+  const int fibN = 36;
+  const unsigned int sortSize = 1 << 23;
+  unsigned int threadCounts[] = {1, 2, 4, 8};
+
+  std::cout << "hardware_threads," << std::thread::hardware_concurrency() << std::endl;
+  std::cout << "workload,threads,serial_ms,pool_ms,speedup" << std::endl;
+
+  auto serialFibMilliseconds = milliseconds([&] { sink = serialFib(fibN); });
+  double baseline = 0;
+  for (auto threads : threadCounts)
+  {
+    WorkStealingPool pool(threads);
+    auto poolMilliseconds = milliseconds([&] { pool.run([&] { sink = parallelFib(pool, fibN); }); });
+    if (threads == 1) baseline = poolMilliseconds;
+    std::cout << "fib(" << fibN << ")," << threads << "," << serialFibMilliseconds << "," << poolMilliseconds << ","
+              << baseline / poolMilliseconds << std::endl;
+  }
+
+  auto values = randomValues(sortSize);
+  auto serialSortMilliseconds = milliseconds([&] { serialSort(values.data(), values.data() + values.size()); });
+  for (auto threads : threadCounts)
+  {
+    WorkStealingPool pool(threads);
+    values = randomValues(sortSize);
+    auto poolMilliseconds =
+        milliseconds([&] { pool.run([&] { parallelSort(pool, values.data(), values.data() + values.size()); }); });
+    if (!std::is_sorted(values.begin(), values.end())) std::cout << "quicksort produced unsorted output" << std::endl;
+    if (threads == 1) baseline = poolMilliseconds;
+    std::cout << "quicksort(" << sortSize << ")," << threads << "," << serialSortMilliseconds << ","
+              << poolMilliseconds << "," << baseline / poolMilliseconds << std::endl;
+  }
+
+  return 0;
+}
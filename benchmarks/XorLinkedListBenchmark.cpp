@@ -0,0 +1,97 @@
+/*
+  Benchmarks | XOR-Linked List
+
+  Builds a `DoublyLinkedList` and an `XorLinkedList` of the same size by
+  appending, then times a full head-to-tail traversal. Each build runs in
+  a forked child so that its resident set growth, read from
+  `/proc/self/statm`, belongs to that list alone. Memory is reported per
+  element and includes the pools' slab overhead.
+
+  Build and run:
+    g++ -std=c++17 -O2 -DNDEBUG benchmarks/XorLinkedListBenchmark.cpp -o xorlist && ./xorlist
+*/
+
+#define DSA_NO_MAIN
+#include "../data-structures/linked-lists/DoublyLinkedList.cpp"
+#include "../data-structures/linked-lists/XorLinkedList.cpp"
+
+#include <chrono>
+#include <fstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+long residentBytes()
+{
+  long pages = 0, residentPages = 0;
+  std::ifstream statm("/proc/self/statm");
+  statm >> pages >> residentPages;
+  return residentPages * sysconf(_SC_PAGESIZE);
+}
+
+template <typename Traverse>
+double traversalNanosecondsPerElement(unsigned int size, Traverse traverse)
+{
+  auto start = std::chrono::steady_clock::now();
+  const int passes = 5;
+  volatile long long sink = 0;
+  for (int pass = 0; pass < passes; pass++) sink = sink + traverse();
+  auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return seconds * 1e9 / passes / size;
+}
+
+void measureDoublyLinkedList(unsigned int size)
+{
+  auto before = residentBytes();
+  DoublyLinkedList list;
+  for (unsigned int i = 0; i < size; i++) list.append(i);
+  auto bytes = residentBytes() - before;
+  auto nanoseconds = traversalNanosecondsPerElement(size, [&list] {
+    long long sum = 0;
+    for (auto cursor = list.cursorAt(0); cursor.valid(); cursor.next()) sum += cursor.get();
+    return sum;
+  });
+  std::cout << "DoublyLinkedList," << size << "," << (double)bytes / size << "," << nanoseconds << std::endl;
+}
+
+void measureXorLinkedList(unsigned int size)
+{
+  auto before = residentBytes();
+  XorLinkedList list;
+  for (unsigned int i = 0; i < size; i++) list.append(i);
+  auto bytes = residentBytes() - before;
+  auto nanoseconds = traversalNanosecondsPerElement(size, [&list] {
+    long long sum = 0;
+    for (auto element : list) sum += element;
+    return sum;
+  });
+  std::cout << "XorLinkedList," << size << "," << (double)bytes / size << "," << nanoseconds << std::endl;
+}
+
+template <typename Measure>
+void inChild(Measure measure, unsigned int size)
+{
+  std::cout.flush();
+  auto child = fork();
+  if (child == 0)
+  {
+    measure(size);
+    std::cout.flush();
+    _exit(0);
+  }
+  int status = 0;
+  waitpid(child, &status, 0);
+}
+
+int main()
+{
+  unsigned int sizes[] = {100000, 1000000, 10000000};
+
+  std::cout << "container,size,rss_bytes_per_element,traversal_ns_per_element" << std::endl;
+  for (auto size : sizes)
+  {
+    inChild(measureDoublyLinkedList, size);
+    inChild(measureXorLinkedList, size);
+  }
+
+  return 0;
+}
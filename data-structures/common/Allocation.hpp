@@ -0,0 +1,120 @@
+/*
+  Data Structures | Allocation
+
+  Compile-time buffer allocation policy shared by the array-backed
+  containers (`DynamicArray`, `StackDynamicArray`, `StackStaticArray`).
+
+  `DefaultAllocation` uses `malloc`/`realloc`/`free`. `AlignedAllocation`
+  returns buffers aligned to `Alignment` bytes, so vector loads never split
+  a cache line. Buffers of at least `HugePageThreshold` bytes are mapped
+  directly from the kernel instead. They first ask for `MAP_HUGETLB` pages
+  and fall back to regular pages marked with `MADV_HUGEPAGE`, so that
+  transparent huge pages can back them. Large arrays then need far fewer
+  TLB entries. Huge pages are Linux-only; other systems use aligned heap
+  memory for every size.
+
+  | Policy                 | Alignment | Huge pages from |
+  | DefaultAllocation      | malloc    | never           |
+  | CacheAlignedAllocation | 64 bytes  | 2 MiB           |
+*/
+
+#ifndef DSA_ALLOCATION_HPP
+#define DSA_ALLOCATION_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+struct DefaultAllocation
+{
+  static void *allocate(std::size_t bytes)
+  {
+    if (bytes == 0) return nullptr;
+    auto *ptr = std::malloc(bytes);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+  }
+
+  static void *reallocate(void *ptr, std::size_t, std::size_t newBytes)
+  {
+    if (newBytes == 0)
+    {
+      std::free(ptr);
+      return nullptr;
+    }
+    auto *tempPtr = std::realloc(ptr, newBytes);
+    if (tempPtr == nullptr) throw std::bad_alloc();
+    return tempPtr;
+  }
+
+  static void deallocate(void *ptr, std::size_t) { std::free(ptr); }
+};
+
+template <std::size_t Alignment, std::size_t HugePageThreshold>
+struct AlignedAllocation
+{
+  static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two.");
+
+  static constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+
+  static bool isHugePageSized(std::size_t bytes)
+  {
+#ifdef __linux__
+    return bytes >= HugePageThreshold;
+#else
+    (void)bytes;
+    return false;
+#endif
+  }
+
+  static void *allocate(std::size_t bytes)
+  {
+    if (bytes == 0) return nullptr;
+#ifdef __linux__
+    if (isHugePageSized(bytes))
+    {
+      auto mappedBytes = (bytes + hugePageSize - 1) / hugePageSize * hugePageSize;
+      auto *ptr = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (ptr != MAP_FAILED) return ptr;
+      ptr = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (ptr == MAP_FAILED) throw std::bad_alloc();
+      madvise(ptr, mappedBytes, MADV_HUGEPAGE);
+      return ptr;
+    }
+#endif
+    auto *ptr = std::aligned_alloc(Alignment, (bytes + Alignment - 1) / Alignment * Alignment);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+  }
+
+  static void *reallocate(void *ptr, std::size_t oldBytes, std::size_t newBytes)
+  {
+    if (ptr == nullptr) return allocate(newBytes);
+    auto *tempPtr = allocate(newBytes);
+    std::memcpy(tempPtr, ptr, oldBytes < newBytes ? oldBytes : newBytes);
+    deallocate(ptr, oldBytes);
+    return tempPtr;
+  }
+
+  static void deallocate(void *ptr, std::size_t bytes)
+  {
+    if (ptr == nullptr) return;
+#ifdef __linux__
+    if (isHugePageSized(bytes))
+    {
+      munmap(ptr, (bytes + hugePageSize - 1) / hugePageSize * hugePageSize);
+      return;
+    }
+#endif
+    std::free(ptr);
+  }
+};
+
+typedef AlignedAllocation<64, 2 * 1024 * 1024> CacheAlignedAllocation;
+
+#endif
@@ -0,0 +1,224 @@
+/*
+  Data Structures | Epoch Reclamation
+
+  Safe memory reclamation for lock-free containers whose readers must not
+  retry. A thread pins the domain for the length of one operation by
+  announcing the global epoch it read. A node that has been unlinked is
+  retired with the global epoch of the moment it was retired, and is
+  deleted once the global epoch has moved two steps past that. The epoch
+  only moves forward when every pinned thread has announced the current
+  one, so no thread that could still see a node is pinned when it goes.
+
+  Unlike hazard pointers, a reader never has to re-check that the node it
+  is stepping onto is still reachable: every node it can reach stays
+  allocated until its guard is gone. The price is that one thread stalled
+  inside an operation keeps the epoch from moving, and with it every
+  deletion in the domain, until it resumes.
+
+  Each thread that uses a domain gets a record with its announcement and
+  a private list of retired nodes, held by a `Guard` for the length of one
+  operation. Records are reused exactly as in `HazardPointers.hpp`. Every
+  `Threshold` retirements, the retiring thread tries to move the epoch and
+  deletes the nodes of its own that have become safe.
+
+  ---- Time Complexities  ----
+  | Guard   | O(1)           |
+  | Retire  | O(1) amortized |
+  ----------------------------
+  (retire is amortized over `Threshold` retirements, each scan visiting every record)
+*/
+
+#ifndef DSA_EPOCH_RECLAMATION_HPP
+#define DSA_EPOCH_RECLAMATION_HPP
+
+#include <atomic>
+#include <vector>
+
+template <unsigned int Threshold = 64>
+class EpochReclamation
+{
+  static_assert(Threshold > 0, "Retired nodes must be collected at some point.");
+
+private:
+  typedef unsigned int uint;
+  typedef unsigned long long Epoch;
+
+  struct Retired
+  {
+    void *pointer;
+    void (*deleter)(void *);
+    Epoch epoch;
+  };
+
+  struct alignas(64) Record
+  {
+    // The epoch this record's thread is pinned at, shifted left by one with the low bit set, or 0 when unpinned.
+    std::atomic<Epoch> announcement;
+    std::atomic<bool> isActive;
+    Record *nextPtr;
+    std::vector<Retired> retired;
+    uint sinceCollect;
+  };
+
+  struct Hint
+  {
+    unsigned long long domainId;
+    Record *recordPtr;
+  };
+
+  alignas(64) std::atomic<Epoch> _epoch;
+  std::atomic<Record *> _recordsPtr;
+  std::atomic<uint> _records;
+  unsigned long long _id;
+
+  static std::atomic<unsigned long long> &_nextId()
+  {
+    static std::atomic<unsigned long long> nextId(1);
+    return nextId;
+  }
+
+  static Hint &_hint()
+  {
+    thread_local Hint hint = {0, nullptr};
+    return hint;
+  }
+
+  Record *_acquire()
+  {
+    auto &hint = _hint();
+    if (hint.domainId == this->_id && !hint.recordPtr->isActive.exchange(true, std::memory_order_acquire))
+      return hint.recordPtr;
+    auto *recordPtr = this->_recordsPtr.load(std::memory_order_acquire);
+    for (; recordPtr != nullptr; recordPtr = recordPtr->nextPtr)
+    {
+      if (recordPtr->isActive.load(std::memory_order_relaxed)) continue;
+      if (!recordPtr->isActive.exchange(true, std::memory_order_acquire)) break;
+    }
+    if (recordPtr == nullptr)
+    {
+      recordPtr = new Record();
+      recordPtr->announcement.store(0, std::memory_order_relaxed);
+      recordPtr->isActive.store(true, std::memory_order_relaxed);
+      recordPtr->sinceCollect = 0;
+      recordPtr->nextPtr = this->_recordsPtr.load(std::memory_order_relaxed);
+      while (!this->_recordsPtr.compare_exchange_weak(recordPtr->nextPtr, recordPtr, std::memory_order_release,
+                                                      std::memory_order_relaxed));
+      this->_records.fetch_add(1, std::memory_order_relaxed);
+    }
+    hint = {this->_id, recordPtr};
+    return recordPtr;
+  }
+
+  // Announces the current epoch. The fence orders the announcement before every load the operation makes.
+  void _pin(Record *recordPtr)
+  {
+    auto epoch = this->_epoch.load(std::memory_order_seq_cst);
+    recordPtr->announcement.store(epoch << 1 | 1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  void _release(Record *recordPtr)
+  {
+    recordPtr->announcement.store(0, std::memory_order_release);
+    recordPtr->isActive.store(false, std::memory_order_release);
+  }
+
+  void _retire(Record *recordPtr, void *pointer, void (*deleter)(void *))
+  {
+    recordPtr->retired.push_back({pointer, deleter, this->_epoch.load(std::memory_order_seq_cst)});
+    if (++recordPtr->sinceCollect < Threshold) return;
+    recordPtr->sinceCollect = 0;
+    this->_collect(recordPtr);
+  }
+
+  // Moves the epoch on if every pinned thread has caught up with it, then deletes the nodes retired through
+  // `recordPtr` at least two epochs ago.
+  void _collect(Record *recordPtr)
+  {
+    auto epoch = this->_epoch.load(std::memory_order_seq_cst);
+    bool isCaughtUp = true;
+    for (auto *otherPtr = this->_recordsPtr.load(std::memory_order_acquire); otherPtr != nullptr && isCaughtUp;
+         otherPtr = otherPtr->nextPtr)
+    {
+      auto announcement = otherPtr->announcement.load(std::memory_order_seq_cst);
+      if ((announcement & 1) != 0 && announcement >> 1 != epoch) isCaughtUp = false;
+    }
+    if (isCaughtUp && this->_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst)) epoch++;
+    auto &retired = recordPtr->retired;
+    size_t kept = 0;
+    for (auto &entry : retired)
+    {
+      if (entry.epoch + 2 > epoch) retired[kept++] = entry;
+      else entry.deleter(entry.pointer);
+    }
+    retired.resize(kept);
+  }
+
+public:
+  // Holds one record for the calling thread and keeps every node it can reach alive. Guards are meant to live
+  // for a single operation.
+  class Guard
+  {
+  private:
+    EpochReclamation *_domainPtr;
+    Record *_recordPtr;
+
+  public:
+    Guard(EpochReclamation &domain)
+    {
+      this->_domainPtr = &domain;
+      this->_recordPtr = domain._acquire();
+      domain._pin(this->_recordPtr);
+    }
+
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+
+    ~Guard() { this->_domainPtr->_release(this->_recordPtr); }
+
+    // Deletes `pointer` once no thread can still reach it. It must already be unreachable from the structure.
+    template <typename T>
+    void retire(T *pointer)
+    {
+      this->_domainPtr->_retire(this->_recordPtr, pointer, [](void *retiredPtr) { delete static_cast<T *>(retiredPtr); });
+    }
+  };
+
+  EpochReclamation()
+  {
+    this->_epoch.store(0, std::memory_order_relaxed);
+    this->_recordsPtr.store(nullptr, std::memory_order_relaxed);
+    this->_records.store(0, std::memory_order_relaxed);
+    this->_id = _nextId().fetch_add(1, std::memory_order_relaxed);
+  }
+
+  EpochReclamation(const EpochReclamation &) = delete;
+  EpochReclamation &operator=(const EpochReclamation &) = delete;
+
+  // No thread may hold a guard on the domain while it is destroyed.
+  ~EpochReclamation()
+  {
+    auto *recordPtr = this->_recordsPtr.load(std::memory_order_acquire);
+    while (recordPtr != nullptr)
+    {
+      for (auto &entry : recordPtr->retired) entry.deleter(entry.pointer);
+      auto *nextRecordPtr = recordPtr->nextPtr;
+      delete recordPtr;
+      recordPtr = nextRecordPtr;
+    }
+  }
+
+  uint records() { return this->_records.load(std::memory_order_relaxed); }
+
+  // Nodes retired but not yet deleted. Only exact while no thread holds a guard.
+  uint retired()
+  {
+    uint count = 0;
+    for (auto *recordPtr = this->_recordsPtr.load(std::memory_order_acquire); recordPtr != nullptr;
+         recordPtr = recordPtr->nextPtr)
+      count += recordPtr->retired.size();
+    return count;
+  }
+};
+
+#endif
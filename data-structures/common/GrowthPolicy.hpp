@@ -0,0 +1,52 @@
+/*
+  Data Structures | Growth Policy
+
+  Compile-time capacity policy shared by the array-backed containers
+  (`DynamicArray`, `StackDynamicArray`).
+
+  A policy grows the capacity by `Numerator / Denominator` when the buffer is
+  full. It shrinks to half once the size falls to `1 / ShrinkDivisor` of the
+  capacity, or never when `ShrinkDivisor` is 0. Growing by a factor and
+  shrinking at a smaller fraction leaves a gap between the two thresholds, so
+  alternating push/pop at a boundary does not reallocate every time.
+
+  | Policy                 | Growth | Shrink at |
+  | DoublingGrowth         | x2     | 1/4       |
+  | OneAndHalfGrowth       | x1.5   | 1/4       |
+  | GoldenRatioGrowth      | x1.618 | 1/4       |
+  | DoublingNoShrinkGrowth | x2     | never     |
+*/
+
+#ifndef DSA_GROWTH_POLICY_HPP
+#define DSA_GROWTH_POLICY_HPP
+
+#include <limits>
+
+template <unsigned int Numerator, unsigned int Denominator, unsigned int ShrinkDivisor>
+struct GrowthPolicy
+{
+  static_assert(Numerator > Denominator, "Growth factor must be greater than 1.");
+  static_assert(ShrinkDivisor == 0 || ShrinkDivisor > 2, "Shrinking must leave room below the halved capacity.");
+
+  static unsigned int grow(unsigned int capacity)
+  {
+    const unsigned long long maxCapacity = std::numeric_limits<unsigned int>::max();
+    unsigned long long next = (unsigned long long)capacity * Numerator / Denominator;
+    if (next <= capacity) next = (unsigned long long)capacity + 1;
+    return next > maxCapacity ? (unsigned int)maxCapacity : (unsigned int)next;
+  }
+
+  static bool shouldShrink(unsigned int size, unsigned int capacity)
+  {
+    return ShrinkDivisor != 0 && capacity > 1 && size <= capacity / (ShrinkDivisor == 0 ? 1 : ShrinkDivisor);
+  }
+
+  static unsigned int shrink(unsigned int capacity) { return capacity / 2; }
+};
+
+typedef GrowthPolicy<2, 1, 4> DoublingGrowth;
+typedef GrowthPolicy<3, 2, 4> OneAndHalfGrowth;
+typedef GrowthPolicy<1618, 1000, 4> GoldenRatioGrowth;
+typedef GrowthPolicy<2, 1, 0> DoublingNoShrinkGrowth;
+
+#endif
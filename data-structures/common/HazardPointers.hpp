@@ -0,0 +1,226 @@
+/*
+  Data Structures | Hazard Pointers
+
+  Safe memory reclamation for the lock-free containers. A thread that is
+  about to dereference a shared node first publishes the node's address in
+  one of its hazard slots and then checks that the node is still reachable.
+  A node that has been unlinked is retired instead of deleted, and is only
+  deleted once no thread's hazard slot holds its address.
+
+  Each thread that uses a domain gets a record with `Slots` hazard slots
+  and a private list of retired nodes, both held by a `Guard` for the
+  length of one operation. Records are never freed while the domain lives;
+  a released record is reused by the next guard, and every thread first
+  tries the record it released last, so the common path touches no shared
+  cache line. When a record has retired more than about twice as many
+  nodes as there are hazard slots in the domain, the retiring thread scans
+  every slot and deletes the retired nodes that none of them holds. This
+  bounds the nodes awaiting deletion to O(threads²) and costs O(1)
+  amortized per retired node.
+
+  ---- Time Complexities  ----
+  | Guard   | O(1)           |
+  | Protect | O(1)           |
+  | Retire  | O(1) amortized |
+  ----------------------------
+*/
+
+#ifndef DSA_HAZARD_POINTERS_HPP
+#define DSA_HAZARD_POINTERS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+template <unsigned int Slots = 2>
+class HazardPointers
+{
+  static_assert(Slots > 0, "Records must hold at least one hazard slot.");
+
+private:
+  typedef unsigned int uint;
+
+  struct Retired
+  {
+    void *pointer;
+    void (*deleter)(void *);
+  };
+
+  struct alignas(64) Record
+  {
+    std::atomic<const void *> hazards[Slots];
+    std::atomic<bool> isActive;
+    Record *nextPtr;
+    std::vector<Retired> retired;
+  };
+
+  // The record this thread released last, tagged with its domain's id so a hint never outlives its domain.
+  struct Hint
+  {
+    unsigned long long domainId;
+    Record *recordPtr;
+  };
+
+  std::atomic<Record *> _recordsPtr;
+  std::atomic<uint> _records;
+  unsigned long long _id;
+
+  static std::atomic<unsigned long long> &_nextId()
+  {
+    static std::atomic<unsigned long long> nextId(1);
+    return nextId;
+  }
+
+  static Hint &_hint()
+  {
+    thread_local Hint hint = {0, nullptr};
+    return hint;
+  }
+
+  Record *_acquire()
+  {
+    auto &hint = _hint();
+    if (hint.domainId == this->_id && !hint.recordPtr->isActive.exchange(true, std::memory_order_acquire))
+      return hint.recordPtr;
+    auto *recordPtr = this->_recordsPtr.load(std::memory_order_acquire);
+    for (; recordPtr != nullptr; recordPtr = recordPtr->nextPtr)
+    {
+      if (recordPtr->isActive.load(std::memory_order_relaxed)) continue;
+      if (!recordPtr->isActive.exchange(true, std::memory_order_acquire)) break;
+    }
+    if (recordPtr == nullptr)
+    {
+      recordPtr = new Record();
+      for (uint i = 0; i < Slots; i++) recordPtr->hazards[i].store(nullptr, std::memory_order_relaxed);
+      recordPtr->isActive.store(true, std::memory_order_relaxed);
+      recordPtr->nextPtr = this->_recordsPtr.load(std::memory_order_relaxed);
+      while (!this->_recordsPtr.compare_exchange_weak(recordPtr->nextPtr, recordPtr, std::memory_order_release,
+                                                      std::memory_order_relaxed));
+      this->_records.fetch_add(1, std::memory_order_relaxed);
+    }
+    hint = {this->_id, recordPtr};
+    return recordPtr;
+  }
+
+  void _release(Record *recordPtr)
+  {
+    for (uint i = 0; i < Slots; i++) recordPtr->hazards[i].store(nullptr, std::memory_order_release);
+    recordPtr->isActive.store(false, std::memory_order_release);
+  }
+
+  void _retire(Record *recordPtr, void *pointer, void (*deleter)(void *))
+  {
+    recordPtr->retired.push_back({pointer, deleter});
+    if (recordPtr->retired.size() >= 2 * Slots * this->_records.load(std::memory_order_relaxed) + 64)
+      this->_scan(recordPtr);
+  }
+
+  // Deletes every node retired through `recordPtr` that no hazard slot holds.
+  void _scan(Record *recordPtr)
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::vector<const void *> hazards;
+    for (auto *otherPtr = this->_recordsPtr.load(std::memory_order_acquire); otherPtr != nullptr;
+         otherPtr = otherPtr->nextPtr)
+    {
+      for (uint i = 0; i < Slots; i++)
+      {
+        auto *hazardPtr = otherPtr->hazards[i].load(std::memory_order_acquire);
+        if (hazardPtr != nullptr) hazards.push_back(hazardPtr);
+      }
+    }
+    std::sort(hazards.begin(), hazards.end());
+    auto &retired = recordPtr->retired;
+    size_t kept = 0;
+    for (auto &entry : retired)
+    {
+      if (std::binary_search(hazards.begin(), hazards.end(), entry.pointer)) retired[kept++] = entry;
+      else entry.deleter(entry.pointer);
+    }
+    retired.resize(kept);
+  }
+
+public:
+  // Holds one record for the calling thread. Guards are meant to live for a single operation.
+  class Guard
+  {
+  private:
+    HazardPointers *_domainPtr;
+    Record *_recordPtr;
+
+  public:
+    Guard(HazardPointers &domain)
+    {
+      this->_domainPtr = &domain;
+      this->_recordPtr = domain._acquire();
+    }
+
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+
+    ~Guard() { this->_domainPtr->_release(this->_recordPtr); }
+
+    // The caller must re-check that `pointer` is still reachable before dereferencing it.
+    void set(uint slot, const void *pointer) { this->_recordPtr->hazards[slot].store(pointer, std::memory_order_seq_cst); }
+
+    void clear(uint slot) { this->_recordPtr->hazards[slot].store(nullptr, std::memory_order_release); }
+
+    // Loads `source` and publishes it in `slot` until the two agree, then returns the protected pointer.
+    template <typename T>
+    T *protect(uint slot, const std::atomic<T *> &source)
+    {
+      auto *pointer = source.load(std::memory_order_relaxed);
+      while (true)
+      {
+        this->set(slot, pointer);
+        auto *currentPtr = source.load(std::memory_order_seq_cst);
+        if (currentPtr == pointer) return pointer;
+        pointer = currentPtr;
+      }
+    }
+
+    // Deletes `pointer` once no hazard slot holds it. It must already be unreachable from the structure.
+    template <typename T>
+    void retire(T *pointer)
+    {
+      this->_domainPtr->_retire(this->_recordPtr, pointer, [](void *retiredPtr) { delete static_cast<T *>(retiredPtr); });
+    }
+  };
+
+  HazardPointers()
+  {
+    this->_recordsPtr.store(nullptr, std::memory_order_relaxed);
+    this->_records.store(0, std::memory_order_relaxed);
+    this->_id = _nextId().fetch_add(1, std::memory_order_relaxed);
+  }
+
+  HazardPointers(const HazardPointers &) = delete;
+  HazardPointers &operator=(const HazardPointers &) = delete;
+
+  // No thread may hold a guard on the domain while it is destroyed.
+  ~HazardPointers()
+  {
+    auto *recordPtr = this->_recordsPtr.load(std::memory_order_acquire);
+    while (recordPtr != nullptr)
+    {
+      for (auto &entry : recordPtr->retired) entry.deleter(entry.pointer);
+      auto *nextRecordPtr = recordPtr->nextPtr;
+      delete recordPtr;
+      recordPtr = nextRecordPtr;
+    }
+  }
+
+  uint records() { return this->_records.load(std::memory_order_relaxed); }
+
+  // Nodes retired but not yet deleted. Only exact while no thread holds a guard.
+  uint retired()
+  {
+    uint count = 0;
+    for (auto *recordPtr = this->_recordsPtr.load(std::memory_order_acquire); recordPtr != nullptr;
+         recordPtr = recordPtr->nextPtr)
+      count += recordPtr->retired.size();
+    return count;
+  }
+};
+
+#endif
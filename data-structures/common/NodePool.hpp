@@ -0,0 +1,169 @@
+/*
+  Data Structures | Node Pool
+
+  Slab allocator for the linked containers' nodes. Nodes are carved out of
+  contiguous slabs of `SlabSize` slots, so neighbouring nodes tend to share
+  cache lines and pages. Destroyed nodes go onto an intrusive free list
+  threaded through their own storage, and the next `create` reuses them
+  without calling into `malloc`. Slabs are only returned to the system
+  all at once, by `release()` or by the pool's destructor.
+
+  A pool can be shared by several lists of the same node type through a
+  `std::shared_ptr`. A list that is the pool's only owner frees it in bulk
+  on `clear()` instead of returning its nodes one by one.
+
+  `reserve(count)` makes sure the next `count` nodes can be created without
+  another allocation. Whatever the free list and the current slab cannot
+  cover comes from one new slab of that size, so bulk rebuilds, such as
+  restoring a snapshot, allocate at most once per list.
+
+  --- Time Complexities ---
+  | Create         | O(1) |
+  | Destroy        | O(1) |
+  | Reserve        | O(1) |
+  | Release        | O(s) |
+  -------------------------
+*/
+
+#ifndef DSA_NODE_POOL_HPP
+#define DSA_NODE_POOL_HPP
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+template <typename NodeType, unsigned int SlabSize = 256>
+class NodePool
+{
+  static_assert(SlabSize > 0, "Slabs must hold at least one node.");
+
+private:
+  typedef unsigned int uint;
+
+  union Slot
+  {
+    Slot *nextFreePtr;
+    alignas(NodeType) unsigned char storage[sizeof(NodeType)];
+  };
+
+  // A slab header is followed by its slots, so slabs of different sizes can share one list.
+  struct Slab
+  {
+    Slab *nextPtr;
+    uint slots;
+  };
+
+  static constexpr std::size_t _slotsOffset = (sizeof(Slab) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+  static constexpr std::size_t _alignment = alignof(Slot) > alignof(Slab) ? alignof(Slot) : alignof(Slab);
+
+  Slab *_slabsPtr;
+  Slot *_freePtr;
+  uint _unusedSlots;
+  uint _slots;
+  uint _slabs;
+  uint _nodes;
+
+  // Over-aligned slabs go through the aligned `operator new`, the rest through the plain one like any other
+  // node allocation. `release()` must pick the matching `operator delete`.
+  static constexpr bool _isOverAligned = _alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  static Slot *_slotsOf(Slab *slabPtr) { return reinterpret_cast<Slot *>(reinterpret_cast<unsigned char *>(slabPtr) + _slotsOffset); }
+
+  void _addSlab(uint slots)
+  {
+    auto bytes = _slotsOffset + (std::size_t)slots * sizeof(Slot);
+    void *bytesPtr;
+    if (_isOverAligned) bytesPtr = ::operator new(bytes, std::align_val_t(_alignment));
+    else bytesPtr = ::operator new(bytes);
+    auto *slabPtr = static_cast<Slab *>(bytesPtr);
+    slabPtr->nextPtr = this->_slabsPtr;
+    slabPtr->slots = slots;
+    this->_slabsPtr = slabPtr;
+    this->_unusedSlots = slots;
+    this->_slots += slots;
+    this->_slabs++;
+  }
+
+  Slot *_takeSlot()
+  {
+    if (this->_freePtr != nullptr)
+    {
+      auto *slotPtr = this->_freePtr;
+      this->_freePtr = slotPtr->nextFreePtr;
+      return slotPtr;
+    }
+    if (this->_unusedSlots == 0) this->_addSlab(SlabSize);
+    return &_slotsOf(this->_slabsPtr)[this->_slabsPtr->slots - this->_unusedSlots--];
+  }
+
+public:
+  uint slabs() { return this->_slabs; }
+  uint nodes() { return this->_nodes; }
+
+  NodePool()
+  {
+    this->_slabsPtr = nullptr;
+    this->_freePtr = nullptr;
+    this->_unusedSlots = 0;
+    this->_slots = 0;
+    this->_slabs = 0;
+    this->_nodes = 0;
+  }
+
+  NodePool(const NodePool &) = delete;
+  NodePool &operator=(const NodePool &) = delete;
+
+  ~NodePool() { this->release(); }
+
+  template <typename... Args>
+  NodeType *create(Args &&...args)
+  {
+    auto *slotPtr = this->_takeSlot();
+    auto *nodePtr = new (slotPtr->storage) NodeType(std::forward<Args>(args)...);
+    this->_nodes++;
+    return nodePtr;
+  }
+
+  void reserve(uint count)
+  {
+    auto available = this->_slots - this->_nodes;
+    if (count <= available) return;
+    // The current slab's unused slots move to the free list, so none is lost when the new slab takes its place.
+    while (this->_unusedSlots > 0)
+    {
+      auto *slotPtr = &_slotsOf(this->_slabsPtr)[this->_slabsPtr->slots - this->_unusedSlots--];
+      slotPtr->nextFreePtr = this->_freePtr;
+      this->_freePtr = slotPtr;
+    }
+    auto needed = count - available;
+    this->_addSlab(needed > SlabSize ? needed : SlabSize);
+  }
+
+  void destroy(NodeType *nodePtr)
+  {
+    nodePtr->~NodeType();
+    auto *slotPtr = reinterpret_cast<Slot *>(nodePtr);
+    slotPtr->nextFreePtr = this->_freePtr;
+    this->_freePtr = slotPtr;
+    this->_nodes--;
+  }
+
+  // Frees every slab at once. Nodes still alive are dropped without running their destructors.
+  void release()
+  {
+    while (this->_slabsPtr != nullptr)
+    {
+      auto *nextSlabPtr = this->_slabsPtr->nextPtr;
+      if (_isOverAligned) ::operator delete(this->_slabsPtr, std::align_val_t(_alignment));
+      else ::operator delete(this->_slabsPtr);
+      this->_slabsPtr = nextSlabPtr;
+    }
+    this->_freePtr = nullptr;
+    this->_unusedSlots = 0;
+    this->_slots = 0;
+    this->_slabs = 0;
+    this->_nodes = 0;
+  }
+};
+
+#endif
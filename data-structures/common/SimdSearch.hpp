@@ -0,0 +1,168 @@
+/*
+  Data Structures | SIMD Search
+
+  Vectorized linear search over contiguous `int` buffers, shared by the
+  array-backed containers for `contains`, `indexOf`, `count` and `findAll`.
+
+  On x86 the widest kernel the CPU supports (AVX-512, AVX2, then SSE2) is
+  picked once at first use. Other targets use the scalar loop. Every kernel
+  compares a whole register of elements per step and only drops to scalar
+  code for the tail, so search is bound by memory bandwidth rather than
+  by compare throughput.
+
+  --- Time Complexities ---
+  | Index of       | O(n) |
+  | Count          | O(n) |
+  -------------------------
+*/
+
+#ifndef DSA_SIMD_SEARCH_HPP
+#define DSA_SIMD_SEARCH_HPP
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DSA_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace simd
+{
+  typedef unsigned int uint;
+  typedef int (*IndexOfKernel)(const int *, uint, uint, int);
+  typedef uint (*CountKernel)(const int *, uint, int);
+
+  inline int indexOfScalar(const int *arrayPtr, uint start, uint size, int element)
+  {
+    for (uint i = start; i < size; i++) if (arrayPtr[i] == element) return i;
+    return -1;
+  }
+
+  inline uint countScalar(const int *arrayPtr, uint size, int element)
+  {
+    uint count = 0;
+    for (uint i = 0; i < size; i++) count += arrayPtr[i] == element;
+    return count;
+  }
+
+#ifdef DSA_SIMD_X86
+  __attribute__((target("sse2"))) inline int indexOfSse2(const int *arrayPtr, uint start, uint size, int element)
+  {
+    auto needle = _mm_set1_epi32(element);
+    uint i = start;
+    for (; i + 4 <= size; i += 4)
+    {
+      auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(arrayPtr + i));
+      auto mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+      if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    return indexOfScalar(arrayPtr, i, size, element);
+  }
+
+  __attribute__((target("sse2"))) inline uint countSse2(const int *arrayPtr, uint size, int element)
+  {
+    auto needle = _mm_set1_epi32(element);
+    uint count = 0;
+    uint i = 0;
+    for (; i + 4 <= size; i += 4)
+    {
+      auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(arrayPtr + i));
+      count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle))));
+    }
+    return count + countScalar(arrayPtr + i, size - i, element);
+  }
+
+  __attribute__((target("avx2"))) inline int indexOfAvx2(const int *arrayPtr, uint start, uint size, int element)
+  {
+    auto needle = _mm256_set1_epi32(element);
+    uint i = start;
+    for (; i + 8 <= size; i += 8)
+    {
+      auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(arrayPtr + i));
+      auto mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+      if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    return indexOfScalar(arrayPtr, i, size, element);
+  }
+
+  __attribute__((target("avx2"))) inline uint countAvx2(const int *arrayPtr, uint size, int element)
+  {
+    auto needle = _mm256_set1_epi32(element);
+    uint count = 0;
+    uint i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+      auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(arrayPtr + i));
+      count += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle))));
+    }
+    return count + countScalar(arrayPtr + i, size - i, element);
+  }
+
+  __attribute__((target("avx512f"))) inline int indexOfAvx512(const int *arrayPtr, uint start, uint size, int element)
+  {
+    auto needle = _mm512_set1_epi32(element);
+    uint i = start;
+    for (; i + 16 <= size; i += 16)
+    {
+      auto mask = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(arrayPtr + i), needle);
+      if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    return indexOfScalar(arrayPtr, i, size, element);
+  }
+
+  __attribute__((target("avx512f"))) inline uint countAvx512(const int *arrayPtr, uint size, int element)
+  {
+    auto needle = _mm512_set1_epi32(element);
+    uint count = 0;
+    uint i = 0;
+    for (; i + 16 <= size; i += 16)
+      count += __builtin_popcount(_mm512_cmpeq_epi32_mask(_mm512_loadu_si512(arrayPtr + i), needle));
+    return count + countScalar(arrayPtr + i, size - i, element);
+  }
+#endif
+
+  inline IndexOfKernel selectIndexOf()
+  {
+#ifdef DSA_SIMD_X86
+    if (__builtin_cpu_supports("avx512f")) return indexOfAvx512;
+    if (__builtin_cpu_supports("avx2")) return indexOfAvx2;
+    if (__builtin_cpu_supports("sse2")) return indexOfSse2;
+#endif
+    return indexOfScalar;
+  }
+
+  inline CountKernel selectCount()
+  {
+#ifdef DSA_SIMD_X86
+    if (__builtin_cpu_supports("avx512f")) return countAvx512;
+    if (__builtin_cpu_supports("avx2")) return countAvx2;
+    if (__builtin_cpu_supports("sse2")) return countSse2;
+#endif
+    return countScalar;
+  }
+
+  // Returns the first index at or after `start` holding `element`, or -1.
+  inline int indexOf(const int *arrayPtr, uint start, uint size, int element)
+  {
+    static const IndexOfKernel kernel = selectIndexOf();
+    return kernel(arrayPtr, start, size, element);
+  }
+
+  inline uint count(const int *arrayPtr, uint size, int element)
+  {
+    static const CountKernel kernel = selectCount();
+    return kernel(arrayPtr, size, element);
+  }
+
+  // Calls `visit(index)` for every index holding `element`, in ascending order.
+  template <typename Visitor>
+  void findAll(const int *arrayPtr, uint size, int element, Visitor visit)
+  {
+    int i = indexOf(arrayPtr, 0, size, element);
+    while (i != -1)
+    {
+      visit((uint)i);
+      i = indexOf(arrayPtr, i + 1, size, element);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,273 @@
+/*
+  Data Structures | Snapshot
+
+  Versioned binary snapshots of the containers' elements. A snapshot file
+  is a 64-byte header followed by the elements exactly as they sit in
+  memory, in container order: index order for arrays, head to tail for
+  lists and bottom to top for stacks. The header records a magic string,
+  the format version, the element size, a hash of the element type, the
+  element count and the capacity the container had, so a restored array
+  comes back with the same room to grow.
+
+  `Writer` streams a snapshot out. Handing it a contiguous buffer writes
+  the header and the whole buffer with one `writev`; single elements are
+  gathered into 64 KiB blocks first. The snapshot is written to a fresh
+  temporary file next to its destination, synced, and renamed over `path`
+  only once it is complete, so a crash or a failed write leaves any
+  previous snapshot at `path` untouched, and concurrent saves to the same
+  path each replace it whole. `View` maps a snapshot read-only and
+  checks its header. Its `data()` points straight into the mapping, so
+  nothing is parsed and a container restores itself with one copy from
+  the page cache, asking the kernel to read ahead as it goes.
+
+  Only trivially copyable elements can be saved, and the bytes are in the
+  writing machine's byte order. This implementation is POSIX-only.
+*/
+
+#ifndef DSA_SNAPSHOT_HPP
+#define DSA_SNAPSHOT_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+struct alignas(64) SnapshotHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t elementSize;
+  uint64_t typeHash;
+  uint64_t count;
+  uint64_t capacity;
+};
+
+namespace snapshot
+{
+  static constexpr char magic[8] = {'D', 'S', 'A', 'S', 'N', 'A', 'P', '\0'};
+  static constexpr uint32_t version = 1;
+
+  // FNV-1a over the type's name, so a snapshot written for one type is not loaded as another.
+  template <typename T>
+  uint64_t typeHash()
+  {
+    uint64_t hash = 14695981039346656037ull;
+    for (const char *namePtr = typeid(T).name(); *namePtr != '\0'; namePtr++)
+    {
+      hash ^= (unsigned char)*namePtr;
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
+  template <typename T>
+  class Writer
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshot elements must be trivially copyable.");
+
+  private:
+    typedef unsigned int uint;
+    static const std::size_t _blockBytes = 1 << 16;
+    int _fileDescriptor;
+    std::string _path;
+    std::string _temporaryPath;
+    std::vector<unsigned char> _buffer;
+    uint64_t _count;
+    uint64_t _written;
+
+    // Writes the buffered bytes followed by `bytes` bytes at `dataPtr`, retrying short writes.
+    void _writeThrough(const void *dataPtr, std::size_t bytes)
+    {
+      iovec parts[2] = {{this->_buffer.data(), this->_buffer.size()}, {const_cast<void *>(dataPtr), bytes}};
+      iovec *partPtr = parts;
+      int remainingParts = 2;
+      while (remainingParts > 0)
+      {
+        if (partPtr->iov_len == 0)
+        {
+          partPtr++;
+          remainingParts--;
+          continue;
+        }
+        auto written = writev(this->_fileDescriptor, partPtr, remainingParts);
+        if (written < 0) throw std::runtime_error("Could not write snapshot file.");
+        while (remainingParts > 0 && (std::size_t)written >= partPtr->iov_len)
+        {
+          written -= partPtr->iov_len;
+          partPtr++;
+          remainingParts--;
+        }
+        if (remainingParts > 0)
+        {
+          partPtr->iov_base = static_cast<unsigned char *>(partPtr->iov_base) + written;
+          partPtr->iov_len -= written;
+        }
+      }
+      this->_buffer.clear();
+    }
+
+    // Flushes the directory holding `path`, so the rename that put the snapshot there survives a crash.
+    static void _syncDirectory(const std::string &path)
+    {
+      auto slash = path.rfind('/');
+      auto directory = slash == std::string::npos ? std::string(".") : slash == 0 ? std::string("/") : path.substr(0, slash);
+      auto fileDescriptor = open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+      if (fileDescriptor == -1) return;
+      fsync(fileDescriptor);
+      close(fileDescriptor);
+    }
+
+  public:
+    // Starts a snapshot of `count` elements taken from a container with room for `capacity`. Nothing
+    // replaces `path` until `finish` succeeds.
+    Writer(const std::string &path, uint64_t count, uint64_t capacity)
+    {
+      this->_path = path;
+      this->_temporaryPath = path + ".XXXXXX";
+      this->_fileDescriptor = mkstemp(&this->_temporaryPath[0]);
+      if (this->_fileDescriptor == -1) throw std::runtime_error("Could not open snapshot file.");
+      if (fchmod(this->_fileDescriptor, 0644) != 0)
+      {
+        close(this->_fileDescriptor);
+        unlink(this->_temporaryPath.c_str());
+        throw std::runtime_error("Could not open snapshot file.");
+      }
+      this->_count = count;
+      this->_written = 0;
+      SnapshotHeader header;
+      std::memset(&header, 0, sizeof(header));
+      std::memcpy(header.magic, magic, sizeof(magic));
+      header.version = version;
+      header.elementSize = sizeof(T);
+      header.typeHash = typeHash<T>();
+      header.count = count;
+      header.capacity = capacity < count ? count : capacity;
+      this->_buffer.reserve(_blockBytes);
+      this->_buffer.insert(this->_buffer.end(), reinterpret_cast<unsigned char *>(&header),
+                           reinterpret_cast<unsigned char *>(&header + 1));
+    }
+
+    Writer(const Writer &) = delete;
+    Writer &operator=(const Writer &) = delete;
+
+    // An unfinished snapshot is discarded.
+    ~Writer()
+    {
+      if (this->_fileDescriptor == -1) return;
+      close(this->_fileDescriptor);
+      unlink(this->_temporaryPath.c_str());
+    }
+
+    void append(const T &element)
+    {
+      if (this->_buffer.size() + sizeof(T) > _blockBytes) this->_writeThrough(nullptr, 0);
+      auto *bytesPtr = reinterpret_cast<const unsigned char *>(&element);
+      this->_buffer.insert(this->_buffer.end(), bytesPtr, bytesPtr + sizeof(T));
+      this->_written++;
+    }
+
+    // Writes `count` contiguous elements together with anything still buffered, without copying them.
+    void append(const T *elementsPtr, uint64_t count)
+    {
+      this->_writeThrough(elementsPtr, count * sizeof(T));
+      this->_written += count;
+    }
+
+    // Writes what is still buffered, syncs the file and renames it over `path`. Throws if fewer or more
+    // elements were appended than the header announced.
+    void finish()
+    {
+      if (this->_written != this->_count) throw std::logic_error("Snapshot does not hold the elements its header counts.");
+      this->_writeThrough(nullptr, 0);
+      auto result = fsync(this->_fileDescriptor);
+      result |= close(this->_fileDescriptor);
+      this->_fileDescriptor = -1;
+      if (result == 0) result = rename(this->_temporaryPath.c_str(), this->_path.c_str());
+      if (result != 0)
+      {
+        unlink(this->_temporaryPath.c_str());
+        throw std::runtime_error("Could not write snapshot file.");
+      }
+      _syncDirectory(this->_path);
+    }
+  };
+
+  template <typename T>
+  class View
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "Snapshot elements must be trivially copyable.");
+
+  private:
+    typedef unsigned int uint;
+    void *_mappingPtr;
+    std::size_t _bytes;
+
+    const SnapshotHeader *_header() { return static_cast<const SnapshotHeader *>(this->_mappingPtr); }
+
+  public:
+    // Maps the snapshot at `path` and checks that it holds elements of type `T`. The containers count
+    // their elements in 32 bits, so larger snapshots are refused.
+    View(const std::string &path)
+    {
+      auto fileDescriptor = open(path.c_str(), O_RDONLY);
+      if (fileDescriptor == -1) throw std::runtime_error("Could not open snapshot file.");
+      struct stat fileStatus;
+      if (fstat(fileDescriptor, &fileStatus) != 0)
+      {
+        close(fileDescriptor);
+        throw std::runtime_error("Could not read snapshot file.");
+      }
+      this->_bytes = fileStatus.st_size;
+      if (this->_bytes < sizeof(SnapshotHeader))
+      {
+        close(fileDescriptor);
+        throw std::runtime_error("Snapshot file is truncated.");
+      }
+      this->_mappingPtr = mmap(nullptr, this->_bytes, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+      close(fileDescriptor);
+      if (this->_mappingPtr == MAP_FAILED) throw std::runtime_error("Could not map snapshot file.");
+      madvise(this->_mappingPtr, this->_bytes, MADV_SEQUENTIAL);
+      madvise(this->_mappingPtr, this->_bytes, MADV_WILLNEED);
+
+      try
+      {
+        auto *headerPtr = this->_header();
+        if (std::memcmp(headerPtr->magic, magic, sizeof(magic)) != 0) throw std::runtime_error("File is not a snapshot.");
+        if (headerPtr->version != version) throw std::runtime_error("Unsupported snapshot version.");
+        if (headerPtr->elementSize != sizeof(T) || headerPtr->typeHash != typeHash<T>())
+          throw std::runtime_error("Snapshot holds a different element type.");
+        if (headerPtr->capacity > std::numeric_limits<uint>::max() || headerPtr->count > headerPtr->capacity)
+          throw std::length_error("Snapshot is too large.");
+        if (this->_bytes != sizeof(SnapshotHeader) + headerPtr->count * sizeof(T))
+          throw std::runtime_error("Snapshot file is truncated.");
+      }
+      catch (...)
+      {
+        munmap(this->_mappingPtr, this->_bytes);
+        throw;
+      }
+    }
+
+    View(const View &) = delete;
+    View &operator=(const View &) = delete;
+
+    ~View() { munmap(this->_mappingPtr, this->_bytes); }
+
+    const T *data() { return reinterpret_cast<const T *>(this->_header() + 1); }
+    uint count() { return (uint)this->_header()->count; }
+    uint capacity() { return (uint)this->_header()->capacity; }
+  };
+}
+
+#endif
@@ -0,0 +1,124 @@
+/*
+  Data Structures | Thread Pool
+
+  Fixed-size pool of worker threads used by the containers' parallel
+  algorithms. `run(chunks, task)` calls `task(chunk)` once for every chunk
+  index in `[0, chunks)`. The calling thread runs chunk 0 itself, the
+  workers share the rest, and `run` returns once all of them are done.
+
+  `chunksFor(count)` tells an algorithm how many chunks to split `count`
+  elements into. It returns 1 when `count` is below the pool's serial
+  threshold, so small inputs run on the calling thread without paying for
+  a hand-off.
+
+  Tasks must not throw.
+*/
+
+#ifndef DSA_THREAD_POOL_HPP
+#define DSA_THREAD_POOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class ThreadPool
+{
+private:
+  typedef unsigned int uint;
+  std::vector<std::thread> _workers;
+  std::queue<std::function<void()>> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _taskAvailable;
+  bool _isStopping;
+  uint _serialThreshold;
+
+  void _work()
+  {
+    while (true)
+    {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(this->_mutex);
+        this->_taskAvailable.wait(lock, [this] { return this->_isStopping || !this->_tasks.empty(); });
+        if (this->_tasks.empty()) return;
+        task = std::move(this->_tasks.front());
+        this->_tasks.pop();
+      }
+      task();
+    }
+  }
+
+public:
+  // `threads` counts the calling thread, so a pool of 1 runs everything inline.
+  ThreadPool(uint threads = std::thread::hardware_concurrency(), uint serialThreshold = 1 << 14)
+  {
+    this->_isStopping = false;
+    this->_serialThreshold = serialThreshold == 0 ? 1 : serialThreshold;
+    for (uint i = 1; i < threads; i++) this->_workers.emplace_back([this] { this->_work(); });
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_isStopping = true;
+    }
+    this->_taskAvailable.notify_all();
+    for (auto &worker : this->_workers) worker.join();
+  }
+
+  uint threads() { return (uint)this->_workers.size() + 1; }
+  uint serialThreshold() { return this->_serialThreshold; }
+  void setSerialThreshold(uint serialThreshold) { this->_serialThreshold = serialThreshold == 0 ? 1 : serialThreshold; }
+
+  uint chunksFor(uint count)
+  {
+    if (count < this->_serialThreshold) return 1;
+    auto chunks = count / this->_serialThreshold;
+    return chunks < this->threads() ? chunks : this->threads();
+  }
+
+  template <typename Task>
+  void run(uint chunks, Task task)
+  {
+    if (chunks == 0) return;
+    if (this->_workers.empty())
+    {
+      for (uint chunk = 0; chunk < chunks; chunk++) task(chunk);
+      return;
+    }
+    uint remaining = chunks - 1;
+    std::mutex doneMutex;
+    std::condition_variable done;
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      for (uint chunk = 1; chunk < chunks; chunk++)
+        this->_tasks.push([&, chunk] {
+          task(chunk);
+          std::lock_guard<std::mutex> doneLock(doneMutex);
+          if (--remaining == 0) done.notify_one();
+        });
+    }
+    this->_taskAvailable.notify_all();
+    task(0);
+    std::unique_lock<std::mutex> doneLock(doneMutex);
+    done.wait(doneLock, [&] { return remaining == 0; });
+  }
+
+  // Returns the [begin, end) bounds of `chunk` when `count` elements are split into `chunks` near-equal parts.
+  static std::pair<uint, uint> chunkBounds(uint count, uint chunks, uint chunk)
+  {
+    auto begin = (unsigned long long)count * chunk / chunks;
+    auto end = (unsigned long long)count * (chunk + 1) / chunks;
+    return {(uint)begin, (uint)end};
+  }
+};
+
+#endif
@@ -1,40 +1,147 @@
 /*
   Data Structures | Dynamic Array
 
-  This dynamic array implementation will only cover `int` data types.
-
-  ---    Time Complexities     ---
-  | Append                | O(1) |
-  | Append (expand array) | O(n) |
-  | Insert at index i     | O(n) |
-  | Delete at index i     | O(n) |
-  | Search                | O(n) |
-  | Access index i        | O(1) |
-  --------------------------------
+  This dynamic array implementation is generic over its element type `T`.
+  Elements are move-constructed into the new buffer when the array grows or
+  shrinks. Trivially copyable types skip the per-element loop and are grown
+  with a single `realloc` (under the default allocation), which can extend
+  the buffer in place.
+
+  How the capacity grows and shrinks is chosen by the `Policy` template
+  parameter (see `common/GrowthPolicy.hpp`). The default doubles when full and
+  halves once the array is a quarter full, so appends and deletes stay
+  amortized O(1) even when they alternate around a capacity boundary.
+
+  Searches (`contains`, `indexOf`, `count`, `findAll`) on `int` arrays use the
+  vectorized kernels in `common/SimdSearch.hpp`. Other element types fall
+  back to a loop over `==`.
+
+  Where the buffer comes from is chosen by the `Allocation` template
+  parameter (see `common/Allocation.hpp`). `CacheAlignedAllocation` gives
+  64-byte-aligned buffers and backs large ones with huge pages.
+
+  The `parallel*` algorithms work on the buffer in place, split across the
+  threads of a `ThreadPool` (see `common/ThreadPool.hpp`). Arrays smaller
+  than the pool's serial threshold are processed on the calling thread.
+
+  Arrays of trivially copyable elements can be saved with `saveSnapshot`,
+  which writes the header and the buffer in one write, and restored with
+  `loadSnapshot`, which copies the buffer straight out of the mapped file
+  (see `common/Snapshot.hpp`).
+
+  ----    Time Complexities     ----
+  | Append                | O(1)   |
+  | Append (expand array) | O(n)   |
+  | Append k              | O(k)   |
+  | Insert at index i     | O(n)   |
+  | Insert k at index i   | O(n+k) |
+  | Delete at index i     | O(n)   |
+  | Delete k at index i   | O(n)   |
+  | Search                | O(n)   |
+  | Access index i        | O(1)   |
+  ----------------------------------
 */
 
+#ifndef DSA_DYNAMIC_ARRAY_CPP
+#define DSA_DYNAMIC_ARRAY_CPP
+
 #include <iostream>
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <iterator>
+#include <algorithm>
+#include <string>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <vector>
+#include <atomic>
+#include <functional>
+#include "../common/Allocation.hpp"
+#include "../common/GrowthPolicy.hpp"
+#include "../common/SimdSearch.hpp"
+#include "../common/Snapshot.hpp"
+#include "../common/ThreadPool.hpp"
 
+template <typename T, typename Policy = DoublingGrowth, typename Allocation = DefaultAllocation>
 class DynamicArray
 {
 private:
   typedef unsigned int uint;
-  int *_arrayPtr;
+  T *_arrayPtr;
   uint _size;
   uint _capacity;
   uint _initialCapacity;
-  bool _shouldIncreaseCapacity() { return this->_size <= this->_capacity && this->_size + 1 > this->_capacity; }
-  bool _shouldDecreaseCapacity() { return this->_size - 1 == this->_capacity / 2; }
-  bool _isIndexOutOfBounds(int index) { return index < 0 || index >= this->_size; }
+  bool _shouldIncreaseCapacity() { return this->_size == this->_capacity; }
+  bool _shouldDecreaseCapacity() { return this->_capacity > this->_initialCapacity && Policy::shouldShrink(this->_size, this->_capacity); }
+  bool _isIndexOutOfBounds(uint index) { return index >= this->_size; }
+
+  void _reallocate(uint capacity)
+  {
+    auto oldBytes = (size_t)this->_capacity * sizeof(T);
+    auto newBytes = (size_t)capacity * sizeof(T);
+    if (capacity == 0)
+    {
+      Allocation::deallocate(this->_arrayPtr, oldBytes);
+      this->_arrayPtr = nullptr;
+    }
+    else if constexpr (std::is_trivially_copyable<T>::value)
+      this->_arrayPtr = static_cast<T *>(Allocation::reallocate(this->_arrayPtr, oldBytes, newBytes));
+    else
+    {
+      // Elements whose move may throw are copied, and the old ones are only destroyed once every copy is in
+      // place, so a throwing copy leaves the array as it was.
+      auto *tempArrayPtr = static_cast<T *>(Allocation::allocate(newBytes));
+      uint constructed = 0;
+      try
+      {
+        for (; constructed < this->_size; constructed++)
+          new (&tempArrayPtr[constructed]) T(std::move_if_noexcept(this->_arrayPtr[constructed]));
+      }
+      catch (...)
+      {
+        for (uint i = 0; i < constructed; i++) tempArrayPtr[i].~T();
+        Allocation::deallocate(tempArrayPtr, newBytes);
+        throw;
+      }
+      for (uint i = 0; i < this->_size; i++) this->_arrayPtr[i].~T();
+      Allocation::deallocate(this->_arrayPtr, oldBytes);
+      this->_arrayPtr = tempArrayPtr;
+    }
+    this->_capacity = capacity;
+  }
+
+  void _growTo(uint required)
+  {
+    if (required <= this->_capacity) return;
+    auto capacity = Policy::grow(this->_capacity);
+    while (capacity < required) capacity = Policy::grow(capacity);
+    this->_reallocate(capacity);
+  }
+
+  void _shrinkToPolicy()
+  {
+    if (!this->_shouldDecreaseCapacity()) return;
+    auto capacity = this->_capacity;
+    while (capacity > this->_initialCapacity && Policy::shouldShrink(this->_size, capacity)) capacity = Policy::shrink(capacity);
+    if (capacity < this->_initialCapacity) capacity = this->_initialCapacity;
+    if (capacity < this->_size) capacity = this->_size;
+    this->_reallocate(capacity);
+  }
 
 public:
   uint size() { return this->_size; }
+  uint capacity() { return this->_capacity; }
   bool empty() { return this->_size == 0; }
 
+  // The elements, without bounds checks. Anything that reallocates the array moves them.
+  T *data() { return this->_arrayPtr; }
+
   DynamicArray()
   {
-    this->_arrayPtr = new int[0];
+    this->_arrayPtr = nullptr;
     this->_size = 0;
     this->_capacity = 0;
     this->_initialCapacity = 0;
@@ -42,62 +149,309 @@ public:
 
   DynamicArray(uint capacity)
   {
-    this->_arrayPtr = new int[capacity];
+    this->_arrayPtr = nullptr;
     this->_size = 0;
     this->_capacity = 0;
     this->_initialCapacity = capacity;
+    this->_reallocate(capacity);
+  }
+
+  DynamicArray(const DynamicArray &other) : DynamicArray(other._capacity)
+  {
+    this->_initialCapacity = other._initialCapacity;
+    // Counting each copy as it is made lets the destructor clean up if a later one throws.
+    for (; this->_size < other._size; this->_size++) new (&this->_arrayPtr[this->_size]) T(other._arrayPtr[this->_size]);
+  }
+
+  DynamicArray(DynamicArray &&other) noexcept
+  {
+    this->_arrayPtr = other._arrayPtr;
+    this->_size = other._size;
+    this->_capacity = other._capacity;
+    this->_initialCapacity = other._initialCapacity;
+    other._arrayPtr = nullptr;
+    other._size = 0;
+    other._capacity = 0;
+  }
+
+  DynamicArray &operator=(DynamicArray other) noexcept
+  {
+    std::swap(this->_arrayPtr, other._arrayPtr);
+    std::swap(this->_size, other._size);
+    std::swap(this->_capacity, other._capacity);
+    std::swap(this->_initialCapacity, other._initialCapacity);
+    return *this;
+  }
+
+  ~DynamicArray()
+  {
+    for (uint i = 0; i < this->_size; i++) this->_arrayPtr[i].~T();
+    Allocation::deallocate(this->_arrayPtr, (size_t)this->_capacity * sizeof(T));
   }
 
-  void append(int element)
+  void append(const T &element) { this->emplace_back(element); }
+  void append(T &&element) { this->emplace_back(std::move(element)); }
+
+  template <typename... Args>
+  T &emplace_back(Args &&...args)
   {
-    if (this->_shouldIncreaseCapacity()) this->increaseCapacity();
-    this->_arrayPtr[this->_size++] = element;
+    if (this->_shouldIncreaseCapacity())
+    {
+      // Build the element first, since `args` may refer into the buffer we are about to move.
+      T element(std::forward<Args>(args)...);
+      this->increaseCapacity();
+      new (&this->_arrayPtr[this->_size]) T(std::move(element));
+    }
+    else new (&this->_arrayPtr[this->_size]) T(std::forward<Args>(args)...);
+    return this->_arrayPtr[this->_size++];
   }
 
-  void insert_at(uint index, uint element)
+  void insert_at(uint index, T element)
   {
-    if (this->_shouldIncreaseCapacity()) this->increaseCapacity();
-    for (uint i = this->_capacity - 1; i > index; i--) this->_arrayPtr[i] = this->_arrayPtr[i - 1];
-    this->_arrayPtr[index] = element;
-    this->_size++;
+    this->insertRange(index, std::make_move_iterator(&element), std::make_move_iterator(&element + 1));
   }
 
   void delete_at(uint index)
   {
-    if (this->_shouldDecreaseCapacity()) this->decreaseCapacity();
-    for (uint i = index; i < this->_size; i++) this->_arrayPtr[i] = this->_arrayPtr[i + 1];
-    this->_size--;
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    this->eraseRange(index, index + 1);
+  }
+
+  // Inserts [first, last) before `index` with at most one reallocation and one
+  // block move of the tail. The range must not point into this array.
+  template <typename ForwardIt>
+  void insertRange(uint index, ForwardIt first, ForwardIt last)
+  {
+    if (index > this->_size) throw std::out_of_range("Index is out of bounds.");
+    auto count = (uint)std::distance(first, last);
+    if (count == 0) return;
+    this->_growTo(this->_size + count);
+
+    auto *gapPtr = this->_arrayPtr + index;
+    auto *endPtr = this->_arrayPtr + this->_size;
+    auto tail = this->_size - index;
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+      std::memmove(gapPtr + count, gapPtr, tail * sizeof(T));
+      std::uninitialized_copy(first, last, gapPtr);
+    }
+    else if (count >= tail)
+    {
+      std::uninitialized_move(gapPtr, endPtr, gapPtr + count);
+      auto middle = std::next(first, tail);
+      std::copy(first, middle, gapPtr);
+      std::uninitialized_copy(middle, last, endPtr);
+    }
+    else
+    {
+      std::uninitialized_move(endPtr - count, endPtr, endPtr);
+      std::move_backward(gapPtr, endPtr - count, endPtr);
+      std::copy(first, last, gapPtr);
+    }
+    this->_size += count;
+  }
+
+  template <typename ForwardIt>
+  void appendRange(ForwardIt first, ForwardIt last) { this->insertRange(this->_size, first, last); }
+
+  // Removes the elements at indices [first, last) with one block move and at
+  // most one reallocation.
+  void eraseRange(uint first, uint last)
+  {
+    if (first > last || last > this->_size) throw std::out_of_range("Index is out of bounds.");
+    auto count = last - first;
+    if (count == 0) return;
+
+    auto *firstPtr = this->_arrayPtr + first;
+    auto *endPtr = this->_arrayPtr + this->_size;
+    if constexpr (std::is_trivially_copyable<T>::value)
+      std::memmove(firstPtr, this->_arrayPtr + last, (this->_size - last) * sizeof(T));
+    else
+    {
+      std::move(this->_arrayPtr + last, endPtr, firstPtr);
+      std::destroy(endPtr - count, endPtr);
+    }
+    this->_size -= count;
+    this->_shrinkToPolicy();
   }
 
-  int at(uint index)
+  T &at(uint index)
   {
     if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
     return this->_arrayPtr[index];
   }
 
-  void increaseCapacity()
+  bool contains(const T &element) { return this->indexOf(element) != -1; }
+
+  int indexOf(const T &element)
+  {
+    if constexpr (std::is_same<T, int>::value) return simd::indexOf(this->_arrayPtr, 0, this->_size, element);
+    else
+    {
+      for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) return i;
+      return -1;
+    }
+  }
+
+  uint count(const T &element)
   {
-    if (this->_capacity == 0) this->_capacity = 1;
-    else this->_capacity *= 2;
+    if constexpr (std::is_same<T, int>::value) return simd::count(this->_arrayPtr, this->_size, element);
+    else
+    {
+      uint count = 0;
+      for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) count++;
+      return count;
+    }
+  }
 
-    auto *tempArrayPtr = new int[this->_capacity];
-    for (uint i = 0; i < this->_size; i++)
-      tempArrayPtr[i] = this->_arrayPtr[i];
+  std::vector<uint> findAll(const T &element)
+  {
+    std::vector<uint> indices;
+    if constexpr (std::is_same<T, int>::value)
+      simd::findAll(this->_arrayPtr, this->_size, element, [&indices](uint index) { indices.push_back(index); });
+    else
+      for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) indices.push_back(i);
+    return indices;
+  }
 
-    delete[] this->_arrayPtr;
-    this->_arrayPtr = tempArrayPtr;
+  template <typename Compare = std::less<T>>
+  void parallelSort(ThreadPool &pool, Compare compare = Compare())
+  {
+    auto chunks = pool.chunksFor(this->_size);
+    auto *arrayPtr = this->_arrayPtr;
+    auto size = this->_size;
+    pool.run(chunks, [&](uint chunk) {
+      auto bounds = ThreadPool::chunkBounds(size, chunks, chunk);
+      std::sort(arrayPtr + bounds.first, arrayPtr + bounds.second, compare);
+    });
+
+    // Merge neighbouring sorted runs pairwise until one run is left.
+    for (uint width = 1; width < chunks; width *= 2)
+    {
+      auto merges = (chunks + 2 * width - 1) / (2 * width);
+      pool.run(merges, [&](uint merge) {
+        auto left = merge * 2 * width;
+        auto middle = left + width;
+        if (middle >= chunks) return;
+        auto right = middle + width < chunks ? middle + width : chunks;
+        std::inplace_merge(arrayPtr + ThreadPool::chunkBounds(size, chunks, left).first,
+                           arrayPtr + ThreadPool::chunkBounds(size, chunks, middle).first,
+                           arrayPtr + ThreadPool::chunkBounds(size, chunks, right - 1).second, compare);
+      });
+    }
+  }
+
+  // Folds every element into `initial` with `operation`, which must be associative.
+  template <typename Operation>
+  T parallelReduce(ThreadPool &pool, T initial, Operation operation)
+  {
+    auto chunks = pool.chunksFor(this->_size);
+    std::vector<T> partials(chunks, initial);
+    pool.run(chunks, [&](uint chunk) {
+      auto bounds = ThreadPool::chunkBounds(this->_size, chunks, chunk);
+      if (bounds.first == bounds.second) return;
+      T partial = this->_arrayPtr[bounds.first];
+      for (uint i = bounds.first + 1; i < bounds.second; i++) partial = operation(partial, this->_arrayPtr[i]);
+      partials[chunk] = std::move(partial);
+    });
+
+    T result = initial;
+    for (uint chunk = 0; chunk < chunks; chunk++)
+    {
+      auto bounds = ThreadPool::chunkBounds(this->_size, chunks, chunk);
+      if (bounds.first != bounds.second) result = operation(result, partials[chunk]);
+    }
+    return result;
+  }
+
+  // Returns the lowest index whose element satisfies `predicate`, or -1.
+  template <typename Predicate>
+  int parallelFindFirst(ThreadPool &pool, Predicate predicate)
+  {
+    auto chunks = pool.chunksFor(this->_size);
+    std::atomic<uint> found(this->_size);
+    pool.run(chunks, [&](uint chunk) {
+      auto bounds = ThreadPool::chunkBounds(this->_size, chunks, chunk);
+      for (uint i = bounds.first; i < bounds.second; i++)
+      {
+        // A lower chunk already has a match, so nothing here can be first.
+        if ((i & 1023) == 0 && found.load(std::memory_order_relaxed) < bounds.first) return;
+        if (!predicate(this->_arrayPtr[i])) continue;
+        auto current = found.load(std::memory_order_relaxed);
+        while (i < current && !found.compare_exchange_weak(current, i, std::memory_order_relaxed));
+        return;
+      }
+    });
+    auto index = found.load();
+    return index == this->_size ? -1 : (int)index;
+  }
+
+  template <typename Predicate>
+  uint parallelCount(ThreadPool &pool, Predicate predicate)
+  {
+    auto chunks = pool.chunksFor(this->_size);
+    std::vector<uint> counts(chunks, 0);
+    pool.run(chunks, [&](uint chunk) {
+      auto bounds = ThreadPool::chunkBounds(this->_size, chunks, chunk);
+      uint count = 0;
+      for (uint i = bounds.first; i < bounds.second; i++) count += predicate(this->_arrayPtr[i]) ? 1 : 0;
+      counts[chunk] = count;
+    });
+
+    uint count = 0;
+    for (auto chunkCount : counts) count += chunkCount;
+    return count;
   }
 
+  // Replaces every element with `function(element)`.
+  template <typename Function>
+  void parallelTransform(ThreadPool &pool, Function function)
+  {
+    auto chunks = pool.chunksFor(this->_size);
+    pool.run(chunks, [&](uint chunk) {
+      auto bounds = ThreadPool::chunkBounds(this->_size, chunks, chunk);
+      for (uint i = bounds.first; i < bounds.second; i++) this->_arrayPtr[i] = function(std::move(this->_arrayPtr[i]));
+    });
+  }
+
+  void increaseCapacity() { this->_reallocate(Policy::grow(this->_capacity)); }
+
   void decreaseCapacity()
   {
-    this->_capacity /= 2;
-    if (this->_capacity < this->_initialCapacity) this->_capacity = this->_initialCapacity;
+    auto capacity = Policy::shrink(this->_capacity);
+    if (capacity < this->_initialCapacity) capacity = this->_initialCapacity;
+    if (capacity < this->_size) capacity = this->_size;
+    this->_reallocate(capacity);
+  }
 
-    auto *tempArrayPtr = new int[this->_capacity];
-    for (uint i = 0; i < this->_size; i++) tempArrayPtr[i] = this->_arrayPtr[i];
+  void reserve(uint capacity)
+  {
+    if (capacity > this->_capacity) this->_reallocate(capacity);
+  }
+
+  void shrink_to_fit()
+  {
+    if (this->_size < this->_capacity) this->_reallocate(this->_size);
+  }
 
-    delete[] this->_arrayPtr;
-    this->_arrayPtr = tempArrayPtr;
+  void saveSnapshot(const std::string &path)
+  {
+    snapshot::Writer<T> writer(path, this->_size, this->_capacity);
+    writer.append(this->_arrayPtr, this->_size);
+    writer.finish();
+  }
+
+  // Replaces the elements with those of the snapshot at `path`, keeping the capacity it was saved with.
+  void loadSnapshot(const std::string &path)
+  {
+    snapshot::View<T> view(path);
+    auto capacity = std::max(view.capacity(), this->_initialCapacity);
+    auto *arrayPtr = capacity == 0 ? nullptr : static_cast<T *>(Allocation::allocate((size_t)capacity * sizeof(T)));
+    if (view.count() > 0) std::memcpy(arrayPtr, view.data(), (size_t)view.count() * sizeof(T));
+    Allocation::deallocate(this->_arrayPtr, (size_t)this->_capacity * sizeof(T));
+    this->_arrayPtr = arrayPtr;
+    this->_size = view.count();
+    this->_capacity = capacity;
   }
 
   void toString()
@@ -115,9 +469,32 @@ public:
   }
 };
 
+#ifndef DSA_NO_MAIN
+#include <set>
+#include <glob.h>
+
+// Records the address of every live instance and throws from a copy once `copiesLeft` runs out. It has no move
+// constructor, so the array copies it when reallocating.
+struct ThrowingCopy
+{
+  static inline std::set<const ThrowingCopy *> live;
+  static inline int copiesLeft = 1 << 30;
+  int value;
+
+  ThrowingCopy(int value) : value(value) { live.insert(this); }
+
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value)
+  {
+    if (copiesLeft-- == 0) throw std::runtime_error("Copy failed.");
+    live.insert(this);
+  }
+
+  ~ThrowingCopy() { live.erase(this); }
+};
+
 int main()
 {
-  DynamicArray arr(2);
+  DynamicArray<int> arr(2);
 
   arr.append(1);
   arr.append(2);
@@ -127,7 +504,259 @@ int main()
   arr.append(3);
   arr.delete_at(0);
   arr.delete_at(0);
+
+  assert(arr.size() == 4);
+  assert(arr.at(0) == 3);
+
+  arr.insert_at(0, 7);
+  arr.insert_at(arr.size(), 9);
+
+  assert(arr.at(0) == 7);
+  assert(arr.at(arr.size() - 1) == 9);
+
+  assert(arr.contains(9) == true);
+  assert(arr.contains(1) == false);
+  assert(arr.indexOf(3) == 1);
+  assert(arr.count(3) == 4);
+  assert(arr.findAll(3).size() == 4);
+
   arr.toString();
 
+  DynamicArray<std::string> words;
+
+  words.append("alpha");
+  words.emplace_back(3, 'b');
+  words.insert_at(1, "gamma");
+  words.emplace_back(words.at(0));
+
+  assert(words.size() == 4);
+  assert(words.at(0) == "alpha");
+  assert(words.at(1) == "gamma");
+  assert(words.at(2) == "bbb");
+  assert(words.at(3) == "alpha");
+
+  words.delete_at(1);
+  assert(words.at(1) == "bbb");
+  assert(words.indexOf("alpha") == 0);
+  assert(words.count("alpha") == 2);
+  assert(words.findAll("alpha")[1] == 2);
+
+  DynamicArray<std::string> copy = words;
+  words.at(0) = "changed";
+  assert(copy.at(0) == "alpha");
+
+  words.toString();
+
+  DynamicArray<std::unique_ptr<int>> owners;
+
+  for (int i = 0; i < 10; i++) owners.emplace_back(new int(i));
+  owners.delete_at(0);
+
+  assert(owners.size() == 9);
+  assert(*owners.at(0) == 1);
+  assert(*owners.at(8) == 9);
+
+  DynamicArray<int> boundary;
+
+  for (int i = 0; i < 8; i++) boundary.append(i);
+  assert(boundary.capacity() == 8);
+
+  for (int i = 0; i < 100; i++)
+  {
+    boundary.append(i);
+    boundary.delete_at(boundary.size() - 1);
+  }
+  assert(boundary.capacity() == 16);
+
+  while (boundary.size() > 4) boundary.delete_at(0);
+  assert(boundary.capacity() == 8);
+
+  boundary.reserve(100);
+  assert(boundary.capacity() == 100);
+  boundary.shrink_to_fit();
+  assert(boundary.capacity() == boundary.size());
+  assert(boundary.at(3) == 7);
+
+  DynamicArray<int> batch;
+  int values[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+  batch.appendRange(values, values + 4);
+  batch.insertRange(2, values + 4, values + 8);
+  batch.insertRange(0, values, values + 1);
+  assert(batch.size() == 9);
+  assert(batch.at(0) == 1 && batch.at(1) == 1 && batch.at(3) == 5 && batch.at(6) == 8 && batch.at(8) == 4);
+
+  batch.eraseRange(1, 7);
+  assert(batch.size() == 3);
+  assert(batch.at(0) == 1 && batch.at(1) == 3 && batch.at(2) == 4);
+  assert(batch.capacity() == 8);
+
+  DynamicArray<std::string> names;
+  std::string shortNames[] = {"a", "b"};
+  std::string longNames[] = {"c", "d", "e", "f", "g"};
+
+  names.appendRange(longNames, longNames + 5);
+  names.insertRange(1, shortNames, shortNames + 2);
+  names.insertRange(6, longNames, longNames + 5);
+  assert(names.size() == 12);
+  assert(names.at(1) == "a" && names.at(3) == "d" && names.at(6) == "c" && names.at(11) == "g");
+
+  names.eraseRange(0, 11);
+  assert(names.size() == 1 && names.at(0) == "g");
+
+  DynamicArray<int, DoublingGrowth, CacheAlignedAllocation> aligned;
+
+  for (int i = 0; i < 1000; i++) aligned.append(i);
+  assert(((size_t)&aligned.at(0)) % 64 == 0);
+  aligned.reserve(1 << 20);
+  assert(((size_t)&aligned.at(0)) % 64 == 0);
+  assert(aligned.at(999) == 999);
+
+  DynamicArray<std::string, DoublingGrowth, CacheAlignedAllocation> alignedWords;
+
+  for (int i = 0; i < 100; i++) alignedWords.emplace_back(i, 'x');
+  alignedWords.eraseRange(0, 99);
+  assert(alignedWords.at(0).size() == 99);
+
+  ThreadPool pool(4, 1000);
+  DynamicArray<int> numbers;
+
+  for (int i = 0; i < 100000; i++) numbers.append(99999 - i);
+  numbers.parallelSort(pool);
+  for (int i = 0; i < 100000; i++) assert(numbers.at(i) == i);
+
+  numbers.parallelTransform(pool, [](int element) { return element % 10; });
+  assert(numbers.parallelCount(pool, [](int element) { return element == 3; }) == 10000);
+  assert(numbers.parallelReduce(pool, 5, [](int sum, int element) { return sum + element; }) == 450005);
+  assert(numbers.parallelFindFirst(pool, [](int element) { return element == 9; }) == 9);
+  assert(numbers.parallelFindFirst(pool, [](int element) { return element == 10; }) == -1);
+
+  DynamicArray<std::string> letters;
+  for (int i = 0; i < 5000; i++) letters.emplace_back(1, (char)('z' - i % 26));
+  letters.parallelSort(pool, std::greater<std::string>());
+  assert(letters.at(0) == "z" && letters.at(4999) == "a");
+  assert(letters.parallelReduce(pool, std::string(), [](std::string joined, const std::string &letter) { return joined.size() < 3 ? joined + letter : joined; }) == "zzz");
+
+  DynamicArray<int, OneAndHalfGrowth> oneAndHalf;
+  DynamicArray<int, DoublingNoShrinkGrowth> noShrink;
+
+  for (int i = 0; i < 10; i++)
+  {
+    oneAndHalf.append(i);
+    noShrink.append(i);
+  }
+  assert(oneAndHalf.capacity() == 13);
+
+  while (!noShrink.empty()) noShrink.delete_at(0);
+  assert(noShrink.capacity() == 16);
+
+  // A copy that throws halfway through a reallocation leaves the old buffer, its elements and the capacity
+  // untouched, and nothing leaks.
+  {
+    DynamicArray<ThrowingCopy> fragile;
+    for (int i = 0; i < 8; i++) fragile.emplace_back(i);
+    assert(fragile.capacity() == 8);
+    ThrowingCopy::copiesLeft = 5;
+    bool isCopyFailed = false;
+    try
+    {
+      fragile.emplace_back(8);
+    }
+    catch (const std::runtime_error &)
+    {
+      isCopyFailed = true;
+    }
+    ThrowingCopy::copiesLeft = 1 << 30;
+    assert(isCopyFailed == true);
+    assert(fragile.size() == 8 && fragile.capacity() == 8 && ThrowingCopy::live.size() == 8);
+    for (int i = 0; i < 8; i++) assert(ThrowingCopy::live.count(&fragile.at(i)) == 1 && fragile.at(i).value == i);
+    fragile.emplace_back(8);
+    assert(fragile.size() == 9 && fragile.at(8).value == 8 && ThrowingCopy::live.size() == 9);
+
+    ThrowingCopy::copiesLeft = 2;
+    isCopyFailed = false;
+    try
+    {
+      DynamicArray<ThrowingCopy> copy(fragile);
+    }
+    catch (const std::runtime_error &)
+    {
+      isCopyFailed = true;
+    }
+    ThrowingCopy::copiesLeft = 1 << 30;
+    assert(isCopyFailed == true && ThrowingCopy::live.size() == 9);
+  }
+  assert(ThrowingCopy::live.empty() == true);
+
+  char pathTemplate[] = "/tmp/DynamicArray.snapshot.XXXXXX";
+  auto fileDescriptor = mkstemp(pathTemplate);
+  assert(fileDescriptor != -1);
+  close(fileDescriptor);
+  const std::string path = pathTemplate;
+  DynamicArray<int> saved;
+  for (int i = 0; i < 100000; i++) saved.append(i * 3);
+  saved.saveSnapshot(path);
+
+  DynamicArray<int> restored;
+  restored.append(-1);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 100000 && restored.capacity() == saved.capacity());
+  for (uint i = 0; i < restored.size(); i++) assert(restored.at(i) == (int)i * 3);
+
+  bool isIncomplete = false;
+  try
+  {
+    snapshot::Writer<int> writer(path, 2, 2);
+    writer.append(1);
+    writer.finish();
+  }
+  catch (const std::logic_error &)
+  {
+    isIncomplete = true;
+  }
+  assert(isIncomplete == true);
+  glob_t leftovers;
+  assert(glob((path + ".*").c_str(), 0, nullptr, &leftovers) == GLOB_NOMATCH);
+  globfree(&leftovers);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 100000 && restored.at(99999) == 99999 * 3);
+
+  // Two saves to one path in flight at once: each writes a file of its own, and the last to finish wins whole.
+  {
+    snapshot::Writer<int> first(path, 3, 3), second(path, 2, 2);
+    first.append(1);
+    second.append(7);
+    first.append(2);
+    second.append(8);
+    first.append(3);
+    second.finish();
+    first.finish();
+  }
+  restored.loadSnapshot(path);
+  assert(restored.size() == 3 && restored.at(0) == 1 && restored.at(2) == 3);
+  struct stat fileStatus;
+  assert(stat(path.c_str(), &fileStatus) == 0 && (fileStatus.st_mode & 0777) == 0644);
+
+  DynamicArray<int> empty;
+  empty.saveSnapshot(path);
+  restored.loadSnapshot(path);
+  assert(restored.empty() == true);
+
+  bool isWrongType = false;
+  try
+  {
+    DynamicArray<double> wrongType;
+    wrongType.loadSnapshot(path);
+  }
+  catch (const std::runtime_error &)
+  {
+    isWrongType = true;
+  }
+  assert(isWrongType == true);
+  unlink(path.c_str());
+
   return 0;
 }
+#endif
+
+#endif
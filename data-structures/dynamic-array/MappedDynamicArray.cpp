@@ -0,0 +1,388 @@
+/*
+  Data Structures | Memory-Mapped Dynamic Array
+
+  A `DynamicArray` whose buffer is a memory-mapped file, so its contents
+  survive the process. Opening an existing file maps it as-is: there is
+  nothing to parse, and pages are read lazily as they are touched.
+
+  The file starts with a 64-byte header that records the element size, a
+  hash of the element type, the size and the capacity. The elements follow
+  the header. Growing the array extends the file and remaps it. Shrinking
+  follows the `Policy` template parameter (see `common/GrowthPolicy.hpp`)
+  and truncates the file.
+
+  Only trivially copyable types can be stored, since the bytes on disk are
+  the objects. `flush()` schedules the dirty pages for write-back. `sync()`
+  blocks until they reach the disk. This implementation is POSIX-only.
+
+  ---    Time Complexities     ---
+  | Open                  | O(1) |
+  | Append                | O(1) |
+  | Append (expand array) | O(n) |
+  | Insert at index i     | O(n) |
+  | Delete at index i     | O(n) |
+  | Search                | O(n) |
+  | Access index i        | O(1) |
+  --------------------------------
+*/
+
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <typeinfo>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../common/GrowthPolicy.hpp"
+#include "../common/SimdSearch.hpp"
+
+struct alignas(64) MappedArrayHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t elementSize;
+  uint64_t typeHash;
+  uint64_t size;
+  uint64_t capacity;
+};
+
+template <typename T, typename Policy = DoublingGrowth>
+class MappedDynamicArray
+{
+  static_assert(std::is_trivially_copyable<T>::value, "Mapped elements must be trivially copyable.");
+
+private:
+  typedef unsigned int uint;
+  static constexpr char _magic[8] = {'D', 'S', 'A', 'M', 'A', 'P', '\0', '\0'};
+  static constexpr uint32_t _version = 1;
+  int _fileDescriptor;
+  MappedArrayHeader *_headerPtr;
+  T *_arrayPtr;
+  uint _initialCapacity;
+  bool _shouldIncreaseCapacity() { return this->size() == this->capacity(); }
+  bool _shouldDecreaseCapacity() { return this->capacity() > this->_initialCapacity && Policy::shouldShrink(this->size(), this->capacity()); }
+  bool _isIndexOutOfBounds(uint index) { return index >= this->size(); }
+
+  static uint64_t _typeHash()
+  {
+    // FNV-1a over the type's name, so a file written for one type is not reopened as another.
+    uint64_t hash = 14695981039346656037ull;
+    for (const char *namePtr = typeid(T).name(); *namePtr != '\0'; namePtr++)
+    {
+      hash ^= (unsigned char)*namePtr;
+      hash *= 1099511628211ull;
+    }
+    return hash;
+  }
+
+  static size_t _fileSize(uint capacity) { return sizeof(MappedArrayHeader) + (size_t)capacity * sizeof(T); }
+
+  void _unmap()
+  {
+    if (this->_headerPtr == nullptr) return;
+    munmap(this->_headerPtr, _fileSize(this->capacity()));
+    this->_headerPtr = nullptr;
+    this->_arrayPtr = nullptr;
+  }
+
+  // Maps the first `fileSize` bytes of the file and only then drops the previous mapping, so a failed map
+  // leaves the array on its old one.
+  void _map(size_t fileSize)
+  {
+    auto *mappingPtr = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, this->_fileDescriptor, 0);
+    if (mappingPtr == MAP_FAILED) throw std::runtime_error("Could not map array file.");
+    this->_unmap();
+    this->_headerPtr = static_cast<MappedArrayHeader *>(mappingPtr);
+    this->_arrayPtr = reinterpret_cast<T *>(this->_headerPtr + 1);
+  }
+
+  void _reallocate(uint capacity)
+  {
+    // Extend the file before remapping and cut it only afterwards, so a failed resize leaves the old mapping intact.
+    auto fileSize = _fileSize(capacity);
+    auto isGrowing = capacity > this->capacity();
+    if (isGrowing && ftruncate(this->_fileDescriptor, fileSize) != 0) throw std::runtime_error("Could not resize array file.");
+    try
+    {
+      this->_map(fileSize);
+    }
+    catch (...)
+    {
+      // Give the file back its old length, so it still matches the header.
+      if (isGrowing && ftruncate(this->_fileDescriptor, _fileSize(this->capacity())) != 0)
+        throw std::runtime_error("Could not resize array file.");
+      throw;
+    }
+    this->_headerPtr->capacity = capacity;
+    if (!isGrowing && ftruncate(this->_fileDescriptor, fileSize) != 0) throw std::runtime_error("Could not resize array file.");
+  }
+
+  void _growTo(uint required)
+  {
+    if (required <= this->capacity()) return;
+    auto capacity = Policy::grow(this->capacity());
+    while (capacity < required) capacity = Policy::grow(capacity);
+    this->_reallocate(capacity);
+  }
+
+public:
+  uint size() { return (uint)this->_headerPtr->size; }
+  uint capacity() { return (uint)this->_headerPtr->capacity; }
+  bool empty() { return this->size() == 0; }
+
+  // Opens the array stored at `path`, creating it with room for `capacity` elements if it does not exist.
+  MappedDynamicArray(const std::string &path, uint capacity = 0)
+  {
+    this->_fileDescriptor = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (this->_fileDescriptor == -1) throw std::runtime_error("Could not open array file.");
+    this->_headerPtr = nullptr;
+    this->_arrayPtr = nullptr;
+    this->_initialCapacity = capacity;
+
+    struct stat fileStatus;
+    if (fstat(this->_fileDescriptor, &fileStatus) != 0)
+    {
+      close(this->_fileDescriptor);
+      throw std::runtime_error("Could not read array file.");
+    }
+
+    try
+    {
+      if (fileStatus.st_size == 0)
+      {
+        if (ftruncate(this->_fileDescriptor, _fileSize(capacity)) != 0) throw std::runtime_error("Could not resize array file.");
+        this->_map(_fileSize(capacity));
+        std::memcpy(this->_headerPtr->magic, _magic, sizeof(_magic));
+        this->_headerPtr->version = _version;
+        this->_headerPtr->elementSize = sizeof(T);
+        this->_headerPtr->typeHash = _typeHash();
+        this->_headerPtr->size = 0;
+        this->_headerPtr->capacity = capacity;
+      }
+      else
+      {
+        if ((size_t)fileStatus.st_size < sizeof(MappedArrayHeader)) throw std::runtime_error("Array file is truncated.");
+        this->_map(fileStatus.st_size);
+        if (std::memcmp(this->_headerPtr->magic, _magic, sizeof(_magic)) != 0) throw std::runtime_error("File is not a mapped array.");
+        if (this->_headerPtr->version != _version) throw std::runtime_error("Unsupported mapped array version.");
+        if (this->_headerPtr->elementSize != sizeof(T) || this->_headerPtr->typeHash != _typeHash())
+          throw std::runtime_error("Mapped array holds a different element type.");
+        if ((size_t)fileStatus.st_size != _fileSize(this->capacity()) || this->size() > this->capacity())
+          throw std::runtime_error("Array file is truncated.");
+      }
+    }
+    catch (...)
+    {
+      if (this->_headerPtr != nullptr) munmap(this->_headerPtr, fileStatus.st_size == 0 ? _fileSize(capacity) : fileStatus.st_size);
+      close(this->_fileDescriptor);
+      throw;
+    }
+  }
+
+  MappedDynamicArray(const MappedDynamicArray &) = delete;
+  MappedDynamicArray &operator=(const MappedDynamicArray &) = delete;
+
+  MappedDynamicArray(MappedDynamicArray &&other) noexcept
+  {
+    this->_fileDescriptor = other._fileDescriptor;
+    this->_headerPtr = other._headerPtr;
+    this->_arrayPtr = other._arrayPtr;
+    this->_initialCapacity = other._initialCapacity;
+    other._fileDescriptor = -1;
+    other._headerPtr = nullptr;
+    other._arrayPtr = nullptr;
+  }
+
+  ~MappedDynamicArray()
+  {
+    this->_unmap();
+    if (this->_fileDescriptor != -1) close(this->_fileDescriptor);
+  }
+
+  void append(const T &element)
+  {
+    auto copy = element;
+    if (this->_shouldIncreaseCapacity()) this->increaseCapacity();
+    this->_arrayPtr[this->_headerPtr->size++] = copy;
+  }
+
+  void insert_at(uint index, T element)
+  {
+    if (index > this->size()) throw std::out_of_range("Index is out of bounds.");
+    if (this->_shouldIncreaseCapacity()) this->increaseCapacity();
+    std::memmove(static_cast<void *>(this->_arrayPtr + index + 1), this->_arrayPtr + index, (this->size() - index) * sizeof(T));
+    this->_arrayPtr[index] = element;
+    this->_headerPtr->size++;
+  }
+
+  void delete_at(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    std::memmove(static_cast<void *>(this->_arrayPtr + index), this->_arrayPtr + index + 1, (this->size() - index - 1) * sizeof(T));
+    this->_headerPtr->size--;
+    if (this->_shouldDecreaseCapacity()) this->decreaseCapacity();
+  }
+
+  T &at(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    return this->_arrayPtr[index];
+  }
+
+  bool contains(const T &element) { return this->indexOf(element) != -1; }
+
+  int indexOf(const T &element)
+  {
+    if constexpr (std::is_same<T, int>::value) return simd::indexOf(this->_arrayPtr, 0, this->size(), element);
+    else
+    {
+      for (uint i = 0; i < this->size(); i++) if (this->_arrayPtr[i] == element) return i;
+      return -1;
+    }
+  }
+
+  void increaseCapacity() { this->_reallocate(Policy::grow(this->capacity())); }
+
+  void decreaseCapacity()
+  {
+    auto capacity = Policy::shrink(this->capacity());
+    if (capacity < this->_initialCapacity) capacity = this->_initialCapacity;
+    if (capacity < this->size()) capacity = this->size();
+    this->_reallocate(capacity);
+  }
+
+  void reserve(uint capacity) { this->_growTo(capacity); }
+
+  void shrink_to_fit()
+  {
+    if (this->size() < this->capacity()) this->_reallocate(this->size());
+  }
+
+  // Starts writing dirty pages back to the file without waiting for them.
+  void flush()
+  {
+    if (msync(this->_headerPtr, _fileSize(this->capacity()), MS_ASYNC) != 0) throw std::runtime_error("Could not flush array file.");
+  }
+
+  // Returns once every change so far is on disk.
+  void sync()
+  {
+    if (msync(this->_headerPtr, _fileSize(this->capacity()), MS_SYNC) != 0) throw std::runtime_error("Could not sync array file.");
+    if (fsync(this->_fileDescriptor) != 0) throw std::runtime_error("Could not sync array file.");
+  }
+
+  void toString()
+  {
+    std::cout << "[";
+    for (uint i = 0; i < this->size(); i++)
+    {
+      if (i == this->size() - 1) std::cout << this->_arrayPtr[i];
+      else std::cout << this->_arrayPtr[i] << ", ";
+    }
+    std::cout << "]" << std::endl;
+    std::cout << "Size: " << this->size() << std::endl;
+    std::cout << "Capacity: " << this->capacity() << std::endl;
+    std::cout << "Initial Capacity: " << this->_initialCapacity << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+#include <cstdio>
+#include <sys/resource.h>
+
+int main()
+{
+  char pathTemplate[] = "/tmp/MappedDynamicArray.bin.XXXXXX";
+  auto fileDescriptor = mkstemp(pathTemplate);
+  assert(fileDescriptor != -1);
+  close(fileDescriptor);
+  const std::string path = pathTemplate;
+
+  {
+    MappedDynamicArray<int> arr(path, 2);
+
+    arr.append(1);
+    arr.append(2);
+    arr.append(3);
+    arr.insert_at(0, 0);
+    arr.delete_at(3);
+
+    assert(arr.size() == 3);
+    assert(arr.capacity() == 4);
+    assert(arr.at(0) == 0 && arr.at(2) == 2);
+
+    for (int i = 3; i < 100; i++) arr.append(i);
+    arr.sync();
+  }
+
+  {
+    MappedDynamicArray<int> reopened(path);
+
+    assert(reopened.size() == 100);
+    assert(reopened.capacity() == 128);
+    assert(reopened.at(99) == 99);
+    assert(reopened.indexOf(50) == 50);
+
+    while (reopened.size() > 3) reopened.delete_at(reopened.size() - 1);
+    reopened.flush();
+    reopened.toString();
+  }
+
+  // A grow whose mapping fails leaves the array on its old mapping, still usable and still matching its file.
+  {
+    MappedDynamicArray<int> arr(path);
+    auto capacity = arr.capacity();
+    rlimit limit;
+    getrlimit(RLIMIT_AS, &limit);
+    auto restoredLimit = limit;
+    long pages = 0;
+    FILE *statusPtr = fopen("/proc/self/statm", "r");
+    if (statusPtr != nullptr && fscanf(statusPtr, "%ld", &pages) == 1)
+    {
+      limit.rlim_cur = (rlim_t)pages * sysconf(_SC_PAGESIZE) + (64 << 20);
+      setrlimit(RLIMIT_AS, &limit);
+    }
+    if (statusPtr != nullptr) fclose(statusPtr);
+    bool isMapFailed = false;
+    try
+    {
+      arr.reserve(1u << 28);
+    }
+    catch (const std::runtime_error &)
+    {
+      isMapFailed = true;
+    }
+    setrlimit(RLIMIT_AS, &restoredLimit);
+    if (pages > 0) assert(isMapFailed == true);
+    assert(arr.size() == 3 && arr.capacity() == capacity && arr.at(2) == 2);
+    arr.append(3);
+    assert(arr.at(3) == 3);
+  }
+
+  {
+    MappedDynamicArray<int> reopened(path);
+    assert(reopened.size() == 4 && reopened.at(3) == 3);
+  }
+
+  bool rejected = false;
+  try
+  {
+    MappedDynamicArray<double> wrongType(path);
+  }
+  catch (const std::runtime_error &)
+  {
+    rejected = true;
+  }
+  assert(rejected == true);
+
+  unlink(path.c_str());
+
+  return 0;
+}
+#endif
@@ -0,0 +1,512 @@
+/*
+  Data Structures | Small Dynamic Array
+
+  A `DynamicArray` with room for its first `N` elements inside the object
+  itself. Arrays that never hold more than `N` elements never touch the
+  heap. Once the array outgrows the inline buffer its elements spill into a
+  heap buffer, and they move back inline when it shrinks to `N` or fewer.
+
+  The API matches `DynamicArray`, including the `Policy` template parameter
+  from `common/GrowthPolicy.hpp`. The capacity never drops below `N`.
+
+  ----    Time Complexities     ----
+  | Append                | O(1)   |
+  | Append (expand array) | O(n)   |
+  | Append k              | O(k)   |
+  | Insert at index i     | O(n)   |
+  | Insert k at index i   | O(n+k) |
+  | Delete at index i     | O(n)   |
+  | Delete k at index i   | O(n)   |
+  | Search                | O(n)   |
+  | Access index i        | O(1)   |
+  ----------------------------------
+*/
+
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <iterator>
+#include <algorithm>
+#include <string>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <vector>
+#include "../common/GrowthPolicy.hpp"
+#include "../common/SimdSearch.hpp"
+
+template <typename T, unsigned int N, typename Policy = DoublingGrowth>
+class SmallDynamicArray
+{
+  static_assert(N > 0, "Inline capacity must be at least 1.");
+
+private:
+  typedef unsigned int uint;
+  T *_arrayPtr;
+  uint _size;
+  uint _capacity;
+  uint _initialCapacity;
+  alignas(T) unsigned char _inlineStorage[N * sizeof(T)];
+  T *_inlinePtr() { return reinterpret_cast<T *>(this->_inlineStorage); }
+  bool _shouldIncreaseCapacity() { return this->_size == this->_capacity; }
+  bool _shouldDecreaseCapacity() { return this->_capacity > this->_initialCapacity && Policy::shouldShrink(this->_size, this->_capacity); }
+  bool _isIndexOutOfBounds(uint index) { return index >= this->_size; }
+
+  void _reallocate(uint capacity)
+  {
+    if (capacity < N) capacity = N;
+    if (capacity == this->_capacity) return;
+
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+      if (!this->isInline() && capacity > N)
+      {
+        auto *tempArrayPtr = static_cast<T *>(std::realloc(this->_arrayPtr, capacity * sizeof(T)));
+        if (tempArrayPtr == nullptr) throw std::bad_alloc();
+        this->_arrayPtr = tempArrayPtr;
+        this->_capacity = capacity;
+        return;
+      }
+    }
+
+    T *tempArrayPtr = this->_inlinePtr();
+    if (capacity > N)
+    {
+      tempArrayPtr = static_cast<T *>(std::malloc(capacity * sizeof(T)));
+      if (tempArrayPtr == nullptr) throw std::bad_alloc();
+    }
+    if constexpr (std::is_trivially_copyable<T>::value)
+      std::memcpy(static_cast<void *>(tempArrayPtr), this->_arrayPtr, this->_size * sizeof(T));
+    else
+    {
+      // Every element is in the new buffer before any old one is destroyed, so a throwing copy leaves the
+      // array as it was.
+      uint constructed = 0;
+      try
+      {
+        for (; constructed < this->_size; constructed++)
+          new (&tempArrayPtr[constructed]) T(std::move_if_noexcept(this->_arrayPtr[constructed]));
+      }
+      catch (...)
+      {
+        for (uint i = 0; i < constructed; i++) tempArrayPtr[i].~T();
+        if (capacity > N) std::free(tempArrayPtr);
+        throw;
+      }
+      for (uint i = 0; i < this->_size; i++) this->_arrayPtr[i].~T();
+    }
+    if (!this->isInline()) std::free(this->_arrayPtr);
+    this->_arrayPtr = tempArrayPtr;
+    this->_capacity = capacity;
+  }
+
+  void _growTo(uint required)
+  {
+    if (required <= this->_capacity) return;
+    auto capacity = Policy::grow(this->_capacity);
+    while (capacity < required) capacity = Policy::grow(capacity);
+    this->_reallocate(capacity);
+  }
+
+  void _shrinkToPolicy()
+  {
+    if (!this->_shouldDecreaseCapacity()) return;
+    auto capacity = this->_capacity;
+    while (capacity > this->_initialCapacity && Policy::shouldShrink(this->_size, capacity)) capacity = Policy::shrink(capacity);
+    if (capacity < this->_initialCapacity) capacity = this->_initialCapacity;
+    if (capacity < this->_size) capacity = this->_size;
+    this->_reallocate(capacity);
+  }
+
+  // Takes `other`'s elements into this empty inline array, stealing its heap buffer or moving its inline
+  // elements. Moved elements are counted here as they arrive and `other`'s are only destroyed once all have
+  // moved, so a throwing move leaves both arrays safe to destroy.
+  void _takeFrom(SmallDynamicArray &other)
+  {
+    if (other.isInline())
+    {
+      for (; this->_size < other._size; this->_size++)
+        new (&this->_arrayPtr[this->_size]) T(std::move(other._arrayPtr[this->_size]));
+      for (uint i = 0; i < other._size; i++) other._arrayPtr[i].~T();
+    }
+    else
+    {
+      this->_arrayPtr = other._arrayPtr;
+      other._arrayPtr = other._inlinePtr();
+      this->_size = other._size;
+    }
+    this->_capacity = other._capacity;
+    this->_initialCapacity = other._initialCapacity;
+    other._size = 0;
+    other._capacity = N;
+    other._initialCapacity = N;
+  }
+
+  void _release()
+  {
+    for (uint i = 0; i < this->_size; i++) this->_arrayPtr[i].~T();
+    if (!this->isInline()) std::free(this->_arrayPtr);
+    this->_arrayPtr = this->_inlinePtr();
+    this->_size = 0;
+    this->_capacity = N;
+  }
+
+public:
+  uint size() { return this->_size; }
+  uint capacity() { return this->_capacity; }
+  bool empty() { return this->_size == 0; }
+  bool isInline() { return this->_arrayPtr == this->_inlinePtr(); }
+
+  SmallDynamicArray()
+  {
+    this->_arrayPtr = this->_inlinePtr();
+    this->_size = 0;
+    this->_capacity = N;
+    this->_initialCapacity = N;
+  }
+
+  SmallDynamicArray(uint capacity) : SmallDynamicArray()
+  {
+    if (capacity > N) this->_initialCapacity = capacity;
+    this->_reallocate(capacity);
+  }
+
+  SmallDynamicArray(const SmallDynamicArray &other) : SmallDynamicArray(other._capacity)
+  {
+    this->_initialCapacity = other._initialCapacity;
+    // Counting each copy as it is made lets the destructor clean up if a later one throws.
+    for (; this->_size < other._size; this->_size++) new (&this->_arrayPtr[this->_size]) T(other._arrayPtr[this->_size]);
+  }
+
+  // Moving inline elements can only throw if `T`'s move constructor can.
+  SmallDynamicArray(SmallDynamicArray &&other) noexcept(std::is_nothrow_move_constructible<T>::value)
+      : SmallDynamicArray()
+  {
+    this->_takeFrom(other);
+  }
+
+  SmallDynamicArray &operator=(SmallDynamicArray other) noexcept(std::is_nothrow_move_constructible<T>::value)
+  {
+    this->_release();
+    this->_takeFrom(other);
+    return *this;
+  }
+
+  ~SmallDynamicArray() { this->_release(); }
+
+  void append(const T &element) { this->emplace_back(element); }
+  void append(T &&element) { this->emplace_back(std::move(element)); }
+
+  template <typename... Args>
+  T &emplace_back(Args &&...args)
+  {
+    if (this->_shouldIncreaseCapacity())
+    {
+      // Build the element first, since `args` may refer into the buffer we are about to move.
+      T element(std::forward<Args>(args)...);
+      this->increaseCapacity();
+      new (&this->_arrayPtr[this->_size]) T(std::move(element));
+    }
+    else new (&this->_arrayPtr[this->_size]) T(std::forward<Args>(args)...);
+    return this->_arrayPtr[this->_size++];
+  }
+
+  void insert_at(uint index, T element)
+  {
+    this->insertRange(index, std::make_move_iterator(&element), std::make_move_iterator(&element + 1));
+  }
+
+  void delete_at(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    this->eraseRange(index, index + 1);
+  }
+
+  // Inserts [first, last) before `index` with at most one reallocation and one
+  // block move of the tail. The range must not point into this array.
+  template <typename ForwardIt>
+  void insertRange(uint index, ForwardIt first, ForwardIt last)
+  {
+    if (index > this->_size) throw std::out_of_range("Index is out of bounds.");
+    auto count = (uint)std::distance(first, last);
+    if (count == 0) return;
+    this->_growTo(this->_size + count);
+
+    auto *gapPtr = this->_arrayPtr + index;
+    auto *endPtr = this->_arrayPtr + this->_size;
+    auto tail = this->_size - index;
+    if constexpr (std::is_trivially_copyable<T>::value)
+    {
+      std::memmove(static_cast<void *>(gapPtr + count), gapPtr, tail * sizeof(T));
+      std::uninitialized_copy(first, last, gapPtr);
+    }
+    else if (count >= tail)
+    {
+      std::uninitialized_move(gapPtr, endPtr, gapPtr + count);
+      auto middle = std::next(first, tail);
+      std::copy(first, middle, gapPtr);
+      std::uninitialized_copy(middle, last, endPtr);
+    }
+    else
+    {
+      std::uninitialized_move(endPtr - count, endPtr, endPtr);
+      std::move_backward(gapPtr, endPtr - count, endPtr);
+      std::copy(first, last, gapPtr);
+    }
+    this->_size += count;
+  }
+
+  template <typename ForwardIt>
+  void appendRange(ForwardIt first, ForwardIt last) { this->insertRange(this->_size, first, last); }
+
+  // Removes the elements at indices [first, last) with one block move and at
+  // most one reallocation.
+  void eraseRange(uint first, uint last)
+  {
+    if (first > last || last > this->_size) throw std::out_of_range("Index is out of bounds.");
+    auto count = last - first;
+    if (count == 0) return;
+
+    auto *firstPtr = this->_arrayPtr + first;
+    auto *endPtr = this->_arrayPtr + this->_size;
+    if constexpr (std::is_trivially_copyable<T>::value)
+      std::memmove(static_cast<void *>(firstPtr), this->_arrayPtr + last, (this->_size - last) * sizeof(T));
+    else
+    {
+      std::move(this->_arrayPtr + last, endPtr, firstPtr);
+      std::destroy(endPtr - count, endPtr);
+    }
+    this->_size -= count;
+    this->_shrinkToPolicy();
+  }
+
+  T &at(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    return this->_arrayPtr[index];
+  }
+
+  bool contains(const T &element) { return this->indexOf(element) != -1; }
+
+  int indexOf(const T &element)
+  {
+    if constexpr (std::is_same<T, int>::value) return simd::indexOf(this->_arrayPtr, 0, this->_size, element);
+    else
+    {
+      for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) return i;
+      return -1;
+    }
+  }
+
+  uint count(const T &element)
+  {
+    if constexpr (std::is_same<T, int>::value) return simd::count(this->_arrayPtr, this->_size, element);
+    else
+    {
+      uint count = 0;
+      for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) count++;
+      return count;
+    }
+  }
+
+  std::vector<uint> findAll(const T &element)
+  {
+    std::vector<uint> indices;
+    if constexpr (std::is_same<T, int>::value)
+      simd::findAll(this->_arrayPtr, this->_size, element, [&indices](uint index) { indices.push_back(index); });
+    else
+      for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) indices.push_back(i);
+    return indices;
+  }
+
+  void increaseCapacity() { this->_reallocate(Policy::grow(this->_capacity)); }
+
+  void decreaseCapacity()
+  {
+    auto capacity = Policy::shrink(this->_capacity);
+    if (capacity < this->_initialCapacity) capacity = this->_initialCapacity;
+    if (capacity < this->_size) capacity = this->_size;
+    this->_reallocate(capacity);
+  }
+
+  void reserve(uint capacity)
+  {
+    if (capacity > this->_capacity) this->_reallocate(capacity);
+  }
+
+  void shrink_to_fit()
+  {
+    if (this->_size < this->_capacity) this->_reallocate(this->_size);
+  }
+
+  void toString()
+  {
+    std::cout << "[";
+    for (uint i = 0; i < this->_size; i++)
+    {
+      if (i == this->_size - 1) std::cout << this->_arrayPtr[i];
+      else std::cout << this->_arrayPtr[i] << ", ";
+    }
+    std::cout << "]" << std::endl;
+    std::cout << "Size: " << this->_size << std::endl;
+    std::cout << "Capacity: " << this->_capacity << std::endl;
+    std::cout << "Inline Capacity: " << N << std::endl;
+    std::cout << "Inline: " << (this->isInline() ? "yes" : "no") << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+#include <set>
+#include <stdexcept>
+
+// Records the address of every live instance and throws from a copy once `copiesLeft` runs out. It has no move
+// constructor, so the array copies it when reallocating.
+struct ThrowingCopy
+{
+  static inline std::set<const ThrowingCopy *> live;
+  static inline int copiesLeft = 1 << 30;
+  int value;
+
+  ThrowingCopy(int value) : value(value) { live.insert(this); }
+
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value)
+  {
+    if (copiesLeft-- == 0) throw std::runtime_error("Copy failed.");
+    live.insert(this);
+  }
+
+  ~ThrowingCopy() { live.erase(this); }
+};
+
+int main()
+{
+  SmallDynamicArray<int, 4> arr;
+
+  arr.append(1);
+  arr.append(2);
+  arr.append(3);
+  arr.append(4);
+
+  assert(arr.isInline() == true);
+  assert(arr.capacity() == 4);
+
+  arr.append(5);
+
+  assert(arr.isInline() == false);
+  assert(arr.capacity() == 8);
+  assert(arr.at(4) == 5);
+
+  arr.insert_at(0, 0);
+  arr.delete_at(5);
+  assert(arr.at(0) == 0 && arr.at(4) == 4);
+
+  arr.eraseRange(0, 4);
+  assert(arr.size() == 1);
+  assert(arr.isInline() == true);
+  assert(arr.at(0) == 4);
+
+  int values[] = {7, 8, 9};
+  arr.appendRange(values, values + 3);
+  assert(arr.isInline() == true);
+  assert(arr.indexOf(8) == 2);
+  assert(arr.count(9) == 1);
+
+  arr.toString();
+
+  SmallDynamicArray<std::string, 2> words;
+
+  words.append("alpha");
+  words.emplace_back(3, 'b');
+
+  SmallDynamicArray<std::string, 2> inlineCopy = words;
+  assert(inlineCopy.isInline() == true);
+  assert(inlineCopy.at(1) == "bbb");
+
+  words.insert_at(1, "gamma");
+  assert(words.isInline() == false);
+
+  SmallDynamicArray<std::string, 2> moved = std::move(words);
+  assert(moved.size() == 3);
+  assert(moved.at(1) == "gamma");
+  assert(words.empty() == true);
+
+  moved = inlineCopy;
+  assert(moved.size() == 2);
+  assert(moved.isInline() == true);
+  assert(moved.at(0) == "alpha");
+
+  moved.toString();
+
+  SmallDynamicArray<std::unique_ptr<int>, 2> owners;
+
+  for (int i = 0; i < 10; i++) owners.emplace_back(new int(i));
+  while (owners.size() > 1) owners.delete_at(0);
+
+  assert(owners.isInline() == true);
+  assert(*owners.at(0) == 9);
+
+  {
+    SmallDynamicArray<ThrowingCopy, 2> fragile;
+    for (int i = 0; i < 4; i++) fragile.emplace_back(i);
+    auto capacity = fragile.capacity();
+    assert(fragile.isInline() == false && capacity == 4);
+    ThrowingCopy::copiesLeft = 2;
+    bool isCopyFailed = false;
+    try
+    {
+      fragile.emplace_back(4);
+    }
+    catch (const std::runtime_error &)
+    {
+      isCopyFailed = true;
+    }
+    ThrowingCopy::copiesLeft = 1 << 30;
+    assert(isCopyFailed == true);
+    assert(fragile.size() == 4 && fragile.capacity() == capacity && ThrowingCopy::live.size() == 4);
+    for (int i = 0; i < 4; i++) assert(ThrowingCopy::live.count(&fragile.at(i)) == 1 && fragile.at(i).value == i);
+    fragile.emplace_back(4);
+    assert(fragile.size() == 5 && fragile.at(4).value == 4 && ThrowingCopy::live.size() == 5);
+
+    ThrowingCopy::copiesLeft = 2;
+    isCopyFailed = false;
+    try
+    {
+      SmallDynamicArray<ThrowingCopy, 2> copy(fragile);
+    }
+    catch (const std::runtime_error &)
+    {
+      isCopyFailed = true;
+    }
+    ThrowingCopy::copiesLeft = 1 << 30;
+    assert(isCopyFailed == true && ThrowingCopy::live.size() == 5);
+  }
+  assert(ThrowingCopy::live.empty() == true);
+
+  static_assert(std::is_nothrow_move_constructible<SmallDynamicArray<std::string, 2>>::value,
+                "Moving an array of nothrow-movable elements must not throw.");
+  static_assert(!std::is_nothrow_move_constructible<SmallDynamicArray<ThrowingCopy, 2>>::value,
+                "Moving inline elements whose move may throw can throw.");
+  {
+    SmallDynamicArray<ThrowingCopy, 4> fragile;
+    for (int i = 0; i < 3; i++) fragile.emplace_back(i);
+    ThrowingCopy::copiesLeft = 1;
+    bool isMoveFailed = false;
+    try
+    {
+      SmallDynamicArray<ThrowingCopy, 4> moved(std::move(fragile));
+    }
+    catch (const std::runtime_error &)
+    {
+      isMoveFailed = true;
+    }
+    ThrowingCopy::copiesLeft = 1 << 30;
+    assert(isMoveFailed == true && ThrowingCopy::live.size() == 3);
+    for (int i = 0; i < 3; i++) assert(ThrowingCopy::live.count(&fragile.at(i)) == 1 && fragile.at(i).value == i);
+  }
+  assert(ThrowingCopy::live.empty() == true);
+
+  return 0;
+}
+#endif
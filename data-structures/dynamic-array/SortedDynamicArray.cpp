@@ -0,0 +1,241 @@
+/*
+  Data Structures | Sorted Dynamic Array
+
+  A `DynamicArray` that keeps its elements sorted by `Compare`, so lookups
+  are binary searches instead of linear scans.
+
+  For read-mostly data, `buildIndex()` copies the elements into an
+  Eytzinger layout: the implicit binary search tree stored breadth-first.
+  The first levels of the tree then share a handful of cache lines, and
+  `lower_bound` walks it without branches while prefetching four levels
+  ahead. Building the index is O(n). Any insert or delete drops it, and
+  lookups fall back to plain binary search until it is rebuilt.
+  `insertRange` adds a whole batch with one sort and one merge, so the
+  usual pattern is bulk load, `buildIndex()`, then query.
+
+  -------    Time Complexities     -------
+  | Insert                | O(n)         |
+  | Insert k (bulk load)  | O(n+k log k) |
+  | Delete at index i     | O(n)         |
+  | Search                | O(log n)     |
+  | Build index           | O(n)         |
+  | Access index i        | O(1)         |
+  ----------------------------------------
+*/
+
+#ifndef DSA_NO_MAIN
+#define DSA_NO_MAIN
+#include "DynamicArray.cpp"
+#undef DSA_NO_MAIN
+#else
+#include "DynamicArray.cpp"
+#endif
+
+template <typename T, typename Compare = std::less<T>>
+class SortedDynamicArray
+{
+private:
+  typedef unsigned int uint;
+  DynamicArray<T> _elements;
+  std::vector<T> _eytzinger;
+  std::vector<uint> _eytzingerRanks;
+  bool _hasIndex;
+  Compare _compare;
+
+  // Fills the 1-based Eytzinger layout by visiting its tree in order, which visits the sorted elements in order.
+  uint _buildIndex(uint rank, uint position)
+  {
+    if (position > this->_elements.size()) return rank;
+    rank = this->_buildIndex(rank, 2 * position);
+    this->_eytzinger[position] = this->_elements.at(rank);
+    this->_eytzingerRanks[position] = rank;
+    return this->_buildIndex(rank + 1, 2 * position + 1);
+  }
+
+  uint _indexLowerBound(const T &element)
+  {
+    auto size = (uint)this->_elements.size();
+    const T *treePtr = this->_eytzinger.data();
+    uint position = 1;
+    while (position <= size)
+    {
+      __builtin_prefetch(treePtr + 16 * position);
+      position = 2 * position + this->_compare(treePtr[position], element);
+    }
+    // The right turns taken after the last left turn are the trailing ones; dropping them lands on the answer.
+    position >>= __builtin_ffs(~position);
+    return position == 0 ? size : this->_eytzingerRanks[position];
+  }
+
+  uint _binaryLowerBound(const T &element)
+  {
+    uint low = 0;
+    uint high = this->_elements.size();
+    while (low < high)
+    {
+      auto middle = low + (high - low) / 2;
+      if (this->_compare(this->_elements.at(middle), element)) low = middle + 1;
+      else high = middle;
+    }
+    return low;
+  }
+
+  void _dropIndex()
+  {
+    if (!this->_hasIndex) return;
+    this->_hasIndex = false;
+    this->_eytzinger.clear();
+    this->_eytzingerRanks.clear();
+  }
+
+public:
+  uint size() { return this->_elements.size(); }
+  bool empty() { return this->_elements.empty(); }
+  bool hasIndex() { return this->_hasIndex; }
+
+  SortedDynamicArray(Compare compare = Compare())
+  {
+    this->_hasIndex = false;
+    this->_compare = compare;
+  }
+
+  // Returns the index the element was stored at.
+  uint insert(const T &element)
+  {
+    auto index = this->lower_bound(element);
+    this->_dropIndex();
+    this->_elements.insert_at(index, element);
+    return index;
+  }
+
+  // Adds a batch with one sort of the batch and one merge into the existing elements.
+  template <typename ForwardIt>
+  void insertRange(ForwardIt first, ForwardIt last)
+  {
+    this->_dropIndex();
+    auto oldSize = this->_elements.size();
+    this->_elements.appendRange(first, last);
+    if (oldSize == this->_elements.size()) return;
+    auto *beginPtr = &this->_elements.at(0);
+    auto *middlePtr = beginPtr + oldSize;
+    auto *endPtr = beginPtr + this->_elements.size();
+    std::sort(middlePtr, endPtr, this->_compare);
+    std::inplace_merge(beginPtr, middlePtr, endPtr, this->_compare);
+  }
+
+  void delete_at(uint index)
+  {
+    this->_elements.delete_at(index);
+    this->_dropIndex();
+  }
+
+  // Removes one element equal to `element`, returning whether there was one.
+  bool erase(const T &element)
+  {
+    auto index = this->indexOf(element);
+    if (index == -1) return false;
+    this->delete_at(index);
+    return true;
+  }
+
+  // Read-only: writing through it could break the order and leave the search layout stale.
+  const T &at(uint index) { return this->_elements.at(index); }
+
+  // Returns the index of the first element not less than `element`, or size() if there is none.
+  uint lower_bound(const T &element)
+  {
+    if (this->_hasIndex) return this->_indexLowerBound(element);
+    return this->_binaryLowerBound(element);
+  }
+
+  bool contains(const T &element) { return this->indexOf(element) != -1; }
+
+  int indexOf(const T &element)
+  {
+    auto index = this->lower_bound(element);
+    if (index == this->_elements.size() || this->_compare(element, this->_elements.at(index))) return -1;
+    return index;
+  }
+
+  void buildIndex()
+  {
+    auto size = this->_elements.size();
+    this->_eytzinger.assign(size + 1, T());
+    this->_eytzingerRanks.assign(size + 1, 0);
+    this->_buildIndex(0, 1);
+    this->_hasIndex = true;
+  }
+
+  void toString()
+  {
+    this->_elements.toString();
+    std::cout << "Index: " << (this->_hasIndex ? "Eytzinger" : "none") << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+int main()
+{
+  SortedDynamicArray<int> arr;
+
+  arr.insert(5);
+  arr.insert(1);
+  arr.insert(3);
+  arr.insert(3);
+
+  assert(arr.at(0) == 1 && arr.at(1) == 3 && arr.at(3) == 5);
+  static_assert(std::is_const<std::remove_reference<decltype(arr.at(0))>::type>::value, "Sorted elements are read-only.");
+  assert(arr.lower_bound(3) == 1);
+  assert(arr.lower_bound(4) == 3);
+  assert(arr.lower_bound(6) == 4);
+  assert(arr.contains(5) == true);
+  assert(arr.contains(2) == false);
+
+  int values[] = {10, 0, 7, 2, 8, 6, 4, 9};
+  arr.insertRange(values, values + 8);
+  assert(arr.size() == 12);
+  for (uint i = 1; i < arr.size(); i++) assert(arr.at(i - 1) <= arr.at(i));
+
+  arr.buildIndex();
+  assert(arr.hasIndex() == true);
+  assert(arr.indexOf(0) == 0);
+  assert(arr.indexOf(3) == 3);
+  assert(arr.indexOf(10) == 11);
+  assert(arr.indexOf(11) == -1);
+  assert(arr.lower_bound(-1) == 0);
+  assert(arr.lower_bound(11) == 12);
+
+  assert(arr.erase(3) == true);
+  assert(arr.hasIndex() == false);
+  assert(arr.indexOf(3) == 3);
+  assert(arr.erase(1) == true);
+  assert(arr.erase(1) == false);
+
+  arr.toString();
+
+  SortedDynamicArray<int> large;
+  DynamicArray<int> batch;
+
+  for (int i = 0; i < 10000; i++) batch.append((i * 7919) % 10007 * 2);
+  large.insertRange(&batch.at(0), &batch.at(0) + batch.size());
+  large.buildIndex();
+  for (int value = -1; value < 20020; value++)
+  {
+    auto expected = (uint)(std::lower_bound(&large.at(0), &large.at(0) + large.size(), value) - &large.at(0));
+    assert(large.lower_bound(value) == expected);
+  }
+
+  SortedDynamicArray<std::string, std::greater<std::string>> words;
+
+  words.insert("beta");
+  words.insert("alpha");
+  words.insert("gamma");
+  words.buildIndex();
+
+  assert(words.at(0) == "gamma");
+  assert(words.indexOf("alpha") == 2);
+  assert(words.contains("delta") == false);
+
+  return 0;
+}
+#endif
@@ -0,0 +1,689 @@
+/*
+  Data Structures | Array Linked List
+
+  This array-backed doubly-linked list will only cover `int` data types.
+
+  All nodes live in one `DynamicArray` and link to each other by 32-bit
+  index instead of by pointer, so a node is 12 bytes instead of 24. Slots
+  of removed nodes go onto a free list threaded through their `nextIndex`
+  and are reused by the next insert. Because no node holds an address, the
+  list stays valid when the array is reallocated, and its storage can be
+  copied with `memcpy` or written to disk as it is: `nodes()` exposes the
+  array, free slots included, and `headIndex()`, `tailIndex()` and
+  `freeIndex()` the slots where the list and the free list start, with
+  `nullIndex` ending both.
+
+  Inserts and removals leave the list order and the slot order apart over
+  time. `compact()` renumbers the nodes so that slot i holds element i,
+  drops the free slots and shrinks the array, after which a traversal reads
+  the array front to back.
+
+  The API matches `DoublyLinkedList`, down to the contract of `insertAt`:
+  the index must be below `size()`, and inserting at the last index
+  appends, so the new element becomes the tail. A `Cursor` from `cursorAt` holds a
+  slot index, so it survives the array being reallocated, and inserts or
+  erases around its node in O(1). `splice` and `merge` cannot relink nodes
+  across lists, since every list has an array of its own; they move the
+  elements into this list's slots and free the other list's. `sort` sorts
+  the values in a scratch array and writes them back in list order, so the
+  links and any cursors stay where they were.
+
+  `saveSnapshot` writes the elements head to tail (see
+  `common/Snapshot.hpp`). `loadSnapshot` replaces the list with them, laid
+  out compacted in one array allocation.
+
+  ------- Time Complexities  -------
+  | Append at head    | O(1)       |
+  | Append at tail    | O(1)       |
+  | Insert at index i | O(n)       |
+  | Delete at head    | O(1)       |
+  | Delete at tail    | O(1)       |
+  | Delete at index i | O(n)       |
+  | Search            | O(n)       |
+  | Access head       | O(1)       |
+  | Access tail       | O(1)       |
+  | Access index i    | O(n)       |
+  | Cursor insert     | O(1)       |
+  | Cursor erase      | O(1)       |
+  | Splice k at i     | O(n+k)     |
+  | Splice k cursors  | O(k)       |
+  | Merge sorted      | O(n+m)     |
+  | Sort              | O(n log n) |
+  | Compact           | O(n)       |
+  ----------------------------------
+  (appends are amortized O(1) while the array grows)
+*/
+
+#ifndef DSA_NO_MAIN
+#define DSA_NO_MAIN
+#include "../dynamic-array/DynamicArray.cpp"
+#undef DSA_NO_MAIN
+#else
+#include "../dynamic-array/DynamicArray.cpp"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+struct IndexNode
+{
+  int data;
+  unsigned int nextIndex;
+  unsigned int previousIndex;
+};
+
+class ArrayLinkedList
+{
+public:
+  static constexpr unsigned int nullIndex = 0xFFFFFFFFu;
+
+private:
+  typedef unsigned int uint;
+  DynamicArray<IndexNode> _nodes;
+  uint _headIndex;
+  uint _tailIndex;
+  uint _freeIndex;
+  uint _size;
+  bool _isIndexOutOfBounds(uint index) { return index >= this->_size; }
+
+  // Slots handed out by `_create` are always in bounds, so nodes are read straight from the buffer.
+  IndexNode &_node(uint index) { return this->_nodes.data()[index]; }
+
+  uint _create(int data, uint nextIndex, uint previousIndex)
+  {
+    if (this->_freeIndex == nullIndex)
+    {
+      this->_nodes.append({data, nextIndex, previousIndex});
+      return this->_nodes.size() - 1;
+    }
+    auto index = this->_freeIndex;
+    this->_freeIndex = this->_node(index).nextIndex;
+    this->_node(index) = {data, nextIndex, previousIndex};
+    return index;
+  }
+
+  void _destroy(uint index)
+  {
+    this->_node(index).nextIndex = this->_freeIndex;
+    this->_freeIndex = index;
+  }
+
+  // Walks to position `index` from the nearer end and returns the slot it is stored in.
+  uint _slotAt(uint index)
+  {
+    if (index <= this->_size / 2)
+    {
+      auto slot = this->_headIndex;
+      for (uint i = 0; i < index; i++) slot = this->_node(slot).nextIndex;
+      return slot;
+    }
+    auto slot = this->_tailIndex;
+    for (uint i = this->_size - 1; i > index; i--) slot = this->_node(slot).previousIndex;
+    return slot;
+  }
+
+  // Links a new node in front of `nextSlot`, which must not be the head, and returns its slot.
+  uint _linkBefore(uint nextSlot, int data)
+  {
+    auto previousSlot = this->_node(nextSlot).previousIndex;
+    auto slot = this->_create(data, nextSlot, previousSlot);
+    this->_node(previousSlot).nextIndex = slot;
+    this->_node(nextSlot).previousIndex = slot;
+    this->_size++;
+    return slot;
+  }
+
+  // Inserts in front of `nextSlot`, or at the tail when it is `nullIndex`.
+  void _insertBefore(uint nextSlot, int data)
+  {
+    if (nextSlot == nullIndex) this->append(data);
+    else if (nextSlot == this->_headIndex) this->prepend(data);
+    else this->_linkBefore(nextSlot, data);
+  }
+
+  // Unlinks and frees the node in `slot` and returns the slot of its successor.
+  uint _remove(uint slot)
+  {
+    auto nextSlot = this->_node(slot).nextIndex;
+    if (slot == this->_headIndex) this->removeHead();
+    else if (slot == this->_tailIndex) this->removeTail();
+    else
+    {
+      auto previousSlot = this->_node(slot).previousIndex;
+      this->_node(previousSlot).nextIndex = nextSlot;
+      this->_node(nextSlot).previousIndex = previousSlot;
+      this->_destroy(slot);
+      this->_size--;
+    }
+    return nextSlot;
+  }
+
+  void _checkOther(ArrayLinkedList &other)
+  {
+    if (&other == this) throw std::invalid_argument("Cannot move nodes within the same list.");
+  }
+
+  // Moves `count` elements of `other`, starting with the one in `slot`, in front of `nextSlot`.
+  void _moveIn(ArrayLinkedList &other, uint slot, uint count, uint nextSlot)
+  {
+    for (uint i = 0; i < count; i++)
+    {
+      auto data = other._node(slot).data;
+      slot = other._remove(slot);
+      this->_insertBefore(nextSlot, data);
+    }
+  }
+
+public:
+  // Points at one node of a list, or at nothing once moved past either end.
+  class Cursor
+  {
+    friend class ArrayLinkedList;
+
+  private:
+    ArrayLinkedList *_listPtr;
+    uint _slot;
+
+    void _checkValid()
+    {
+      if (this->_slot == nullIndex) throw std::out_of_range("Cursor is out of bounds.");
+    }
+
+  public:
+    Cursor(ArrayLinkedList *listPtr, uint slot)
+    {
+      this->_listPtr = listPtr;
+      this->_slot = slot;
+    }
+
+    bool valid() { return this->_slot != nullIndex; }
+
+    // The reference is only good until the list next grows its array.
+    int &get()
+    {
+      this->_checkValid();
+      return this->_listPtr->_node(this->_slot).data;
+    }
+
+    void next()
+    {
+      this->_checkValid();
+      this->_slot = this->_listPtr->_node(this->_slot).nextIndex;
+    }
+
+    void previous()
+    {
+      this->_checkValid();
+      this->_slot = this->_listPtr->_node(this->_slot).previousIndex;
+    }
+
+    // Moves `delta` nodes towards the tail, or towards the head when negative.
+    void advance(int delta)
+    {
+      for (; delta > 0 && this->_slot != nullIndex; delta--) this->_slot = this->_listPtr->_node(this->_slot).nextIndex;
+      for (; delta < 0 && this->_slot != nullIndex; delta++) this->_slot = this->_listPtr->_node(this->_slot).previousIndex;
+    }
+
+    void insertBefore(int data)
+    {
+      this->_checkValid();
+      this->_listPtr->_insertBefore(this->_slot, data);
+    }
+
+    void insertAfter(int data)
+    {
+      this->_checkValid();
+      this->_listPtr->_insertBefore(this->_listPtr->_node(this->_slot).nextIndex, data);
+    }
+
+    // Removes the node under the cursor and moves the cursor to its successor.
+    void erase()
+    {
+      this->_checkValid();
+      this->_slot = this->_listPtr->_remove(this->_slot);
+    }
+  };
+
+private:
+  void _checkCursor(Cursor &cursor)
+  {
+    if (cursor._listPtr != this) throw std::invalid_argument("Cursor belongs to another list.");
+  }
+
+public:
+  uint size() { return this->_size; }
+  bool empty() { return this->_size == 0; }
+
+  // Slots in the backing array, including free ones.
+  uint slots() { return this->_nodes.size(); }
+
+  // The backing array, `slots()` nodes long. Anything that adds a slot may move it.
+  const IndexNode *nodes() { return this->_nodes.data(); }
+  uint headIndex() { return this->_headIndex; }
+  uint tailIndex() { return this->_tailIndex; }
+  uint freeIndex() { return this->_freeIndex; }
+
+  ArrayLinkedList()
+  {
+    this->_headIndex = nullIndex;
+    this->_tailIndex = nullIndex;
+    this->_freeIndex = nullIndex;
+    this->_size = 0;
+  }
+
+  void clear()
+  {
+    this->_nodes = DynamicArray<IndexNode>();
+    this->_headIndex = nullIndex;
+    this->_tailIndex = nullIndex;
+    this->_freeIndex = nullIndex;
+    this->_size = 0;
+  }
+
+  void append(int data)
+  {
+    auto index = this->_create(data, nullIndex, this->_tailIndex);
+    if (this->empty()) this->_headIndex = index;
+    else this->_node(this->_tailIndex).nextIndex = index;
+    this->_tailIndex = index;
+    this->_size++;
+  }
+
+  void prepend(int data)
+  {
+    auto index = this->_create(data, this->_headIndex, nullIndex);
+    if (this->empty()) this->_tailIndex = index;
+    else this->_node(this->_headIndex).previousIndex = index;
+    this->_headIndex = index;
+    this->_size++;
+  }
+
+  // Inserts so that `data` ends up at `index`; `index` may equal size(), which appends.
+  void insertAt(uint index, int data)
+  {
+    if (index >= this->_size) throw std::out_of_range("Index is out of bounds.");
+    else if (index == 0) this->prepend(data);
+    else if (index == this->_size - 1) this->append(data);
+    else this->_linkBefore(this->_slotAt(index), data);
+  }
+
+  void removeHead()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    auto index = this->_headIndex;
+    this->_headIndex = this->_node(index).nextIndex;
+    if (this->_headIndex == nullIndex) this->_tailIndex = nullIndex;
+    else this->_node(this->_headIndex).previousIndex = nullIndex;
+    this->_destroy(index);
+    this->_size--;
+  }
+
+  void removeTail()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    auto index = this->_tailIndex;
+    this->_tailIndex = this->_node(index).previousIndex;
+    if (this->_tailIndex == nullIndex) this->_headIndex = nullIndex;
+    else this->_node(this->_tailIndex).nextIndex = nullIndex;
+    this->_destroy(index);
+    this->_size--;
+  }
+
+  void removeAt(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    this->_remove(this->_slotAt(index));
+  }
+
+  int atHead()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    return this->_node(this->_headIndex).data;
+  }
+
+  int atTail()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    return this->_node(this->_tailIndex).data;
+  }
+
+  int at(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    return this->_node(this->_slotAt(index)).data;
+  }
+
+  Cursor cursorAt(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    return Cursor(this, this->_slotAt(index));
+  }
+
+  bool contains(int data) { return this->indexOf(data) != -1; }
+
+  int indexOf(int data)
+  {
+    int index = 0;
+    for (auto slot = this->_headIndex; slot != nullIndex; slot = this->_node(slot).nextIndex, index++)
+      if (this->_node(slot).data == data) return index;
+    return -1;
+  }
+
+  // Moves all of `other` in front of index `index`; `index` may equal size().
+  void splice(uint index, ArrayLinkedList &other) { this->splice(index, other, 0, other._size); }
+
+  // Moves the elements at [first, last) of `other` so that they start at `index`.
+  void splice(uint index, ArrayLinkedList &other, uint first, uint last)
+  {
+    this->_checkOther(other);
+    if (index > this->_size || first > last || last > other._size) throw std::out_of_range("Index is out of bounds.");
+    if (first == last) return;
+    auto nextSlot = index == this->_size ? nullIndex : this->_slotAt(index);
+    this->_moveIn(other, other._slotAt(first), last - first, nextSlot);
+  }
+
+  // Moves all of `other` in front of `position`, or to the tail when `position` has run off the list.
+  void splice(Cursor position, ArrayLinkedList &other)
+  {
+    this->_checkOther(other);
+    this->_checkCursor(position);
+    this->_moveIn(other, other._headIndex, other._size, position._slot);
+  }
+
+  // Moves the element under `element`, a cursor into `other`, in front of `position`.
+  void splice(Cursor position, ArrayLinkedList &other, Cursor element)
+  {
+    this->_checkOther(other);
+    this->_checkCursor(position);
+    other._checkCursor(element);
+    element._checkValid();
+    this->_moveIn(other, element._slot, 1, position._slot);
+  }
+
+  // Moves the elements of `other` from `first` up to but not including `last` in front of `position`. A
+  // `last` that has run off the list stands for the end of `other`.
+  void splice(Cursor position, ArrayLinkedList &other, Cursor first, Cursor last)
+  {
+    this->_checkOther(other);
+    this->_checkCursor(position);
+    other._checkCursor(first);
+    other._checkCursor(last);
+    uint count = 0;
+    for (auto slot = first._slot; slot != last._slot; slot = other._node(slot).nextIndex, count++)
+    {
+      if (slot == nullIndex) throw std::invalid_argument("Cursors do not form a range.");
+    }
+    this->_moveIn(other, first._slot, count, position._slot);
+  }
+
+  // Merges the sorted list `other` into this sorted list, leaving `other` empty. On ties the elements already
+  // in this list come first.
+  void merge(ArrayLinkedList &other)
+  {
+    this->_checkOther(other);
+    auto slot = this->_headIndex;
+    for (auto otherSlot = other._headIndex; otherSlot != nullIndex; otherSlot = other._node(otherSlot).nextIndex)
+    {
+      auto data = other._node(otherSlot).data;
+      while (slot != nullIndex && this->_node(slot).data <= data) slot = this->_node(slot).nextIndex;
+      this->_insertBefore(slot, data);
+    }
+    other.clear();
+  }
+
+  void sort()
+  {
+    std::vector<int> values;
+    values.reserve(this->_size);
+    for (auto slot = this->_headIndex; slot != nullIndex; slot = this->_node(slot).nextIndex)
+      values.push_back(this->_node(slot).data);
+    std::sort(values.begin(), values.end());
+    uint i = 0;
+    for (auto slot = this->_headIndex; slot != nullIndex; slot = this->_node(slot).nextIndex)
+      this->_node(slot).data = values[i++];
+  }
+
+  // Renumbers the nodes into list order and releases the free slots.
+  void compact()
+  {
+    DynamicArray<IndexNode> compacted;
+    compacted.reserve(this->_size);
+    uint index = 0;
+    for (auto slot = this->_headIndex; slot != nullIndex; slot = this->_node(slot).nextIndex, index++)
+      compacted.append({this->_node(slot).data, index + 1, index - 1});
+    if (this->_size > 0)
+    {
+      compacted.at(0).previousIndex = nullIndex;
+      compacted.at(this->_size - 1).nextIndex = nullIndex;
+    }
+    this->_nodes = std::move(compacted);
+    this->_headIndex = this->_size > 0 ? 0 : nullIndex;
+    this->_tailIndex = this->_size > 0 ? this->_size - 1 : nullIndex;
+    this->_freeIndex = nullIndex;
+  }
+
+  void saveSnapshot(const std::string &path)
+  {
+    snapshot::Writer<int> writer(path, this->_size, this->_size);
+    for (auto slot = this->_headIndex; slot != nullIndex; slot = this->_node(slot).nextIndex)
+      writer.append(this->_node(slot).data);
+    writer.finish();
+  }
+
+  void loadSnapshot(const std::string &path)
+  {
+    snapshot::View<int> view(path);
+    this->clear();
+    this->_nodes.reserve(view.count());
+    auto *elementsPtr = view.data();
+    for (uint i = 0; i < view.count(); i++) this->append(elementsPtr[i]);
+  }
+
+  void toString()
+  {
+    if (this->empty())
+    {
+      std::cout << "List is empty." << std::endl;
+      return;
+    }
+    for (auto slot = this->_headIndex; slot != nullIndex; slot = this->_node(slot).nextIndex)
+      std::cout << this->_node(slot).data << " <-> ";
+    std::cout << "null" << std::endl;
+    std::cout << "Head: " << this->atHead() << std::endl;
+    std::cout << "Tail: " << this->atTail() << std::endl;
+    std::cout << "Size: " << this->_size << std::endl;
+    std::cout << "Slots: " << this->slots() << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+int main()
+{
+  static_assert(sizeof(IndexNode) == 12, "Links are 32-bit indices.");
+
+  ArrayLinkedList list;
+
+  list.append(10);
+  list.append(11);
+  list.insertAt(list.size() - 1, 12);
+  list.prepend(9);
+  list.prepend(8);
+  list.insertAt(0, 7);
+  list.insertAt(1, 55);
+
+  assert(list.at(0) == 7);
+  assert(list.at(1) == 55);
+  assert(list.at(5) == 11);
+  assert(list.at(list.size() - 1) == 12);
+  assert(list.atHead() == 7);
+  assert(list.atTail() == 12);
+  assert(list.indexOf(9) == 3);
+
+  bool isOutOfBounds = false;
+  try
+  {
+    list.insertAt(list.size(), 14);
+  }
+  catch (const std::out_of_range &)
+  {
+    isOutOfBounds = true;
+  }
+  assert(isOutOfBounds == true && list.size() == 7);
+
+  list.toString();
+
+  list.removeHead();
+  list.removeAt(0);
+  list.removeAt(1);
+  list.removeTail();
+  assert(list.size() == 3 && list.slots() == 7);
+
+  list.append(13);
+  assert(list.slots() == 7);
+  assert(list.at(0) == 8 && list.at(1) == 10 && list.at(2) == 11 && list.at(3) == 13);
+
+  list.compact();
+  assert(list.slots() == 4);
+  assert(list.at(0) == 8 && list.at(1) == 10 && list.at(2) == 11 && list.at(3) == 13);
+  list.insertAt(2, 99);
+  assert(list.at(2) == 99 && list.atTail() == 13);
+
+  list.toString();
+
+  ArrayLinkedList mixed;
+  std::vector<int> expected;
+  for (int i = 0; i < 3000; i++)
+  {
+    auto index = expected.empty() ? 0 : (uint)((i * 7919u) % expected.size());
+    if (i % 3 == 2 && !expected.empty())
+    {
+      mixed.removeAt(index);
+      expected.erase(expected.begin() + index);
+    }
+    else
+    {
+      if (expected.empty()) mixed.append(i);
+      else mixed.insertAt(index, i);
+      if (!expected.empty() && index == expected.size() - 1) index++;
+      expected.insert(expected.begin() + index, i);
+    }
+    if (i == 1500) mixed.compact();
+  }
+  assert(mixed.size() == expected.size());
+  for (uint i = 0; i < expected.size(); i++) assert(mixed.at(i) == expected[i]);
+  mixed.compact();
+  assert(mixed.slots() == expected.size());
+  for (uint i = 0; i < expected.size(); i++) assert(mixed.at(i) == expected[i]);
+
+  mixed.clear();
+  assert(mixed.empty() == true && mixed.slots() == 0);
+  mixed.compact();
+  assert(mixed.empty() == true);
+
+  // The node array can be copied out as it is and walked by index.
+  ArrayLinkedList walked;
+  for (int i = 0; i < 5; i++) walked.prepend(i);
+  walked.removeAt(2);
+  std::vector<IndexNode> copied(walked.nodes(), walked.nodes() + walked.slots());
+  std::vector<int> order;
+  for (auto slot = walked.headIndex(); slot != ArrayLinkedList::nullIndex; slot = copied[slot].nextIndex)
+    order.push_back(copied[slot].data);
+  assert((order == std::vector<int>{4, 3, 1, 0}));
+  assert(walked.freeIndex() == 2 && copied[walked.tailIndex()].data == 0);
+
+  ArrayLinkedList cursorList;
+  for (int i = 0; i < 10; i++) cursorList.append(i);
+  auto cursor = cursorList.cursorAt(4);
+  cursor.insertBefore(40);
+  cursor.insertAfter(60);
+  assert(cursor.get() == 4);
+  cursor.advance(-1);
+  assert(cursor.get() == 40);
+  cursor.erase();
+  assert(cursor.get() == 4 && cursorList.at(4) == 4 && cursorList.at(5) == 60);
+  // The cursor holds a slot, not an address, so it survives the array growing.
+  for (int i = 0; i < 1000; i++) cursorList.append(100 + i);
+  cursor.get() = 44;
+  assert(cursorList.at(4) == 44);
+
+  auto head = cursorList.cursorAt(0);
+  head.insertBefore(-5);
+  head.erase();
+  assert(cursorList.atHead() == -5 && cursorList.at(1) == 1);
+  head.previous();
+  head.erase();
+  assert(cursorList.atHead() == 1 && head.get() == 1);
+
+  auto tail = cursorList.cursorAt(cursorList.size() - 1);
+  tail.insertAfter(5000);
+  tail.next();
+  tail.erase();
+  assert(tail.valid() == false && cursorList.atTail() == 1099);
+
+  ArrayLinkedList source;
+  ArrayLinkedList target;
+  for (int i = 0; i < 6; i++) source.append(i);
+  target.append(100);
+  target.append(101);
+  target.splice(1, source, 2, 5);
+  assert(target.size() == 5 && source.size() == 3);
+  assert(target.at(0) == 100 && target.at(1) == 2 && target.at(3) == 4 && target.atTail() == 101);
+  assert(source.at(1) == 1 && source.atTail() == 5);
+  target.splice(target.size(), source, 2, 3);
+  assert(target.atTail() == 5 && source.atTail() == 1);
+  target.splice(0, source);
+  assert(source.empty() == true && target.atHead() == 0 && target.size() == 8);
+
+  for (int i = 0; i < 6; i++) source.append(10 + i);
+  target.splice(target.cursorAt(1), source, source.cursorAt(3));
+  assert(target.at(1) == 13 && source.size() == 5 && source.at(3) == 14);
+  auto sourceEnd = source.cursorAt(source.size() - 1);
+  sourceEnd.next();
+  target.splice(target.cursorAt(0), source, source.cursorAt(3), sourceEnd);
+  assert(target.atHead() == 14 && target.at(1) == 15 && source.size() == 3);
+  auto targetEnd = target.cursorAt(target.size() - 1);
+  targetEnd.next();
+  target.splice(targetEnd, source);
+  assert(source.empty() == true && target.size() == 14 && target.atTail() == 12);
+
+  target.sort();
+  int sorted[] = {0, 1, 2, 3, 4, 5, 10, 11, 12, 13, 14, 15, 100, 101};
+  for (uint i = 0; i < 14; i++) assert(target.at(i) == sorted[i]);
+
+  for (int i = 0; i < 10; i++) source.append(i * 20);
+  target.merge(source);
+  assert(target.size() == 24 && source.empty() == true);
+  for (uint i = 1; i < target.size(); i++) assert(target.at(i - 1) <= target.at(i));
+  assert(target.atHead() == 0 && target.atTail() == 180);
+
+  bool threw = false;
+  source.append(1);
+  try
+  {
+    target.splice(source.cursorAt(0), source);
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw == true);
+
+  char pathTemplate[] = "/tmp/ArrayLinkedList.snapshot.XXXXXX";
+  auto fileDescriptor = mkstemp(pathTemplate);
+  assert(fileDescriptor != -1);
+  close(fileDescriptor);
+  const std::string path = pathTemplate;
+  ArrayLinkedList saved;
+  for (int i = 0; i < 1000; i++) saved.prepend(i);
+  saved.removeAt(500);
+  saved.saveSnapshot(path);
+  ArrayLinkedList restored;
+  restored.append(-1);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 999 && restored.slots() == 999);
+  for (uint i = 0; i < restored.size(); i++) assert(restored.at(i) == saved.at(i));
+  unlink(path.c_str());
+
+  return 0;
+}
+#endif
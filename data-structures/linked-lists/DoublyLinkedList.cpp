@@ -3,22 +3,62 @@
 
   This doubly-linked list will only cover `int` data types.
 
-  ---- Time Complexities  ----
-  | Append at head    | O(1) |
-  | Append at tail    | O(1) |
-  | Insert at index i | O(n) |
-  | Delete at head    | O(1) |
-  | Delete at tail    | O(1) |
-  | Delete at index i | O(n) |
-  | Search            | O(n) |
-  | Access head       | O(1) |
-  | Access tail       | O(1) |
-  | Access index i    | O(n) |
-  ----------------------------
+  Nodes come from a `NodePool` (see `common/NodePool.hpp`) rather than from
+  `new`/`delete`. By default each list owns its pool. Lists constructed with
+  the same pool share its slabs and free list, and `clear()` on a list that
+  owns its pool alone frees every node at once.
+
+  Positional operations walk from whichever is nearest to the index: the
+  head, the tail, or the node the previous positional operation visited.
+  A loop like `for (i...) list.at(i)` therefore steps one node per call
+  instead of restarting from the head. For edits at a position without any
+  walk, a `Cursor` from `cursorAt` points at one node and inserts or
+  erases around it in O(1). A cursor stays valid until its node is removed
+  by something other than the cursor itself.
+
+  `splice`, `merge` and `sort` only relink existing nodes and never
+  allocate. Because a node must go back to the pool it came from, nodes can
+  only move between lists that share a pool: `splice` and `merge` between
+  two default-constructed lists always throw. Pass both lists the same
+  pool to move nodes between them. `splice` takes its positions either as
+  indices, which walk to them, or as cursors, which relink in O(1); only
+  a cursor range has to be walked, to count the nodes it moves. Cursors
+  on the nodes that moved become invalid, as if the nodes were removed.
+
+  `saveSnapshot` writes the elements head to tail (see
+  `common/Snapshot.hpp`). `loadSnapshot` replaces the list with them,
+  taking every node from a single pool allocation and reading the
+  elements straight out of the mapped file.
+
+  ------- Time Complexities  -------
+  | Append at head    | O(1)       |
+  | Append at tail    | O(1)       |
+  | Insert at index i | O(n)       |
+  | Delete at head    | O(1)       |
+  | Delete at tail    | O(1)       |
+  | Delete at index i | O(n)       |
+  | Search            | O(n)       |
+  | Access head       | O(1)       |
+  | Access tail       | O(1)       |
+  | Access index i    | O(n)       |
+  | Access index i±d  | O(d)       |
+  | Cursor insert     | O(1)       |
+  | Cursor erase      | O(1)       |
+  | Splice all at end | O(1)       |
+  | Splice k at i     | O(n)       |
+  | Splice at cursor  | O(1)       |
+  | Splice k cursors  | O(k)       |
+  | Merge sorted      | O(n)       |
+  | Sort              | O(n log n) |
+  ----------------------------------
+  (i±d = d positions from the previously accessed index)
 */
 
 #include <iostream>
 #include <cassert>
+#include <memory>
+#include "../common/NodePool.hpp"
+#include "../common/Snapshot.hpp"
 
 class Node
 {
@@ -49,22 +89,262 @@ private:
   Node *_headPtr;
   Node *_tailPtr;
   uint _size;
+  std::shared_ptr<NodePool<Node>> _poolPtr;
+  Node *_fingerPtr;
+  uint _fingerIndex;
   bool _isIndexOutOfBounds(uint index) { return index < 0 || index >= this->_size; }
 
+  // Walks to `index` from the nearest of the head, the tail and the finger, and leaves the finger there.
+  Node *_nodeAt(uint index)
+  {
+    auto *traversalPtr = this->_headPtr;
+    uint position = 0;
+    if (this->_size - 1 - index < index)
+    {
+      traversalPtr = this->_tailPtr;
+      position = this->_size - 1;
+    }
+    auto distance = position > index ? position - index : index - position;
+    if (this->_fingerPtr != nullptr)
+    {
+      auto fingerDistance = this->_fingerIndex > index ? this->_fingerIndex - index : index - this->_fingerIndex;
+      if (fingerDistance < distance)
+      {
+        traversalPtr = this->_fingerPtr;
+        position = this->_fingerIndex;
+      }
+    }
+    while (position < index)
+    {
+      traversalPtr = traversalPtr->nextPtr;
+      position++;
+    }
+    while (position > index)
+    {
+      traversalPtr = traversalPtr->previousPtr;
+      position--;
+    }
+    this->_fingerPtr = traversalPtr;
+    this->_fingerIndex = index;
+    return traversalPtr;
+  }
+
+  // Links a new node in front of `nodePtr`, which must not be the head.
+  Node *_linkBefore(Node *nodePtr, int data)
+  {
+    auto *newNodePtr = this->_poolPtr->create(data, nodePtr, nodePtr->previousPtr);
+    nodePtr->previousPtr->nextPtr = newNodePtr;
+    nodePtr->previousPtr = newNodePtr;
+    this->_size++;
+    return newNodePtr;
+  }
+
+  // Unlinks and destroys `nodePtr`, which must be neither the head nor the tail, and returns its successor.
+  Node *_unlink(Node *nodePtr)
+  {
+    auto *nextNodePtr = nodePtr->nextPtr;
+    nodePtr->previousPtr->nextPtr = nextNodePtr;
+    nextNodePtr->previousPtr = nodePtr->previousPtr;
+    this->_poolPtr->destroy(nodePtr);
+    this->_size--;
+    return nextNodePtr;
+  }
+
+  void _checkSharedPool(DoublyLinkedList &other)
+  {
+    if (&other == this) throw std::invalid_argument("Cannot move nodes within the same list.");
+    if (other._poolPtr != this->_poolPtr) throw std::invalid_argument("Lists must share a node pool.");
+  }
+
+  // Cuts the chain after its first `count` nodes and returns the rest.
+  static Node *_cut(Node *nodePtr, uint count)
+  {
+    for (uint i = 1; i < count && nodePtr != nullptr; i++) nodePtr = nodePtr->nextPtr;
+    if (nodePtr == nullptr) return nullptr;
+    auto *restPtr = nodePtr->nextPtr;
+    nodePtr->nextPtr = nullptr;
+    return restPtr;
+  }
+
+  // Merges two sorted chains through `nextPtr` only, taking from `leftPtr` on ties so the merge is stable.
+  static Node *_mergeChains(Node *leftPtr, Node *rightPtr, Node *&tailPtr)
+  {
+    Node *headPtr = nullptr;
+    Node **linkPtr = &headPtr;
+    tailPtr = nullptr;
+    while (leftPtr != nullptr && rightPtr != nullptr)
+    {
+      auto *&smallerPtr = rightPtr->data < leftPtr->data ? rightPtr : leftPtr;
+      *linkPtr = smallerPtr;
+      tailPtr = smallerPtr;
+      linkPtr = &smallerPtr->nextPtr;
+      smallerPtr = smallerPtr->nextPtr;
+    }
+    *linkPtr = leftPtr != nullptr ? leftPtr : rightPtr;
+    for (auto *restPtr = *linkPtr; restPtr != nullptr; restPtr = restPtr->nextPtr) tailPtr = restPtr;
+    return headPtr;
+  }
+
+  // Moves the `count` nodes from `firstPtr` to `lastPtr` out of `other` and links them in front of `nextPtr`,
+  // or at the tail when `nextPtr` is null.
+  void _relink(DoublyLinkedList &other, Node *firstPtr, Node *lastPtr, uint count, Node *nextPtr)
+  {
+    if (firstPtr->previousPtr == nullptr) other._headPtr = lastPtr->nextPtr;
+    else firstPtr->previousPtr->nextPtr = lastPtr->nextPtr;
+    if (lastPtr->nextPtr == nullptr) other._tailPtr = firstPtr->previousPtr;
+    else lastPtr->nextPtr->previousPtr = firstPtr->previousPtr;
+    other._size -= count;
+    other._fingerPtr = nullptr;
+
+    auto *previousPtr = nextPtr == nullptr ? this->_tailPtr : nextPtr->previousPtr;
+    firstPtr->previousPtr = previousPtr;
+    lastPtr->nextPtr = nextPtr;
+    if (previousPtr == nullptr) this->_headPtr = firstPtr;
+    else previousPtr->nextPtr = firstPtr;
+    if (nextPtr == nullptr) this->_tailPtr = lastPtr;
+    else nextPtr->previousPtr = lastPtr;
+    this->_size += count;
+    this->_fingerPtr = nullptr;
+  }
+
+  // Rebuilds every `previousPtr` after the chain was relinked through `nextPtr` alone.
+  void _relinkPrevious()
+  {
+    Node *previousNodePtr = nullptr;
+    for (auto *traversalPtr = this->_headPtr; traversalPtr != nullptr; traversalPtr = traversalPtr->nextPtr)
+    {
+      traversalPtr->previousPtr = previousNodePtr;
+      previousNodePtr = traversalPtr;
+    }
+  }
+
+public:
+  // Points at one node of a list, or at nothing once moved past either end.
+  class Cursor
+  {
+    friend class DoublyLinkedList;
+
+  private:
+    DoublyLinkedList *_listPtr;
+    Node *_nodePtr;
+
+    void _checkValid()
+    {
+      if (this->_nodePtr == nullptr) throw std::out_of_range("Cursor is out of bounds.");
+    }
+
+  public:
+    Cursor(DoublyLinkedList *listPtr, Node *nodePtr)
+    {
+      this->_listPtr = listPtr;
+      this->_nodePtr = nodePtr;
+    }
+
+    bool valid() { return this->_nodePtr != nullptr; }
+
+    int &get()
+    {
+      this->_checkValid();
+      return this->_nodePtr->data;
+    }
+
+    void next()
+    {
+      this->_checkValid();
+      this->_nodePtr = this->_nodePtr->nextPtr;
+    }
+
+    void previous()
+    {
+      this->_checkValid();
+      this->_nodePtr = this->_nodePtr->previousPtr;
+    }
+
+    // Moves `delta` nodes towards the tail, or towards the head when negative.
+    void advance(int delta)
+    {
+      for (; delta > 0 && this->_nodePtr != nullptr; delta--) this->_nodePtr = this->_nodePtr->nextPtr;
+      for (; delta < 0 && this->_nodePtr != nullptr; delta++) this->_nodePtr = this->_nodePtr->previousPtr;
+    }
+
+    void insertBefore(int data)
+    {
+      this->_checkValid();
+      this->_listPtr->_fingerPtr = nullptr;
+      if (this->_nodePtr == this->_listPtr->_headPtr) this->_listPtr->prepend(data);
+      else this->_listPtr->_linkBefore(this->_nodePtr, data);
+    }
+
+    void insertAfter(int data)
+    {
+      this->_checkValid();
+      this->_listPtr->_fingerPtr = nullptr;
+      if (this->_nodePtr == this->_listPtr->_tailPtr) this->_listPtr->append(data);
+      else this->_listPtr->_linkBefore(this->_nodePtr->nextPtr, data);
+    }
+
+    // Removes the node under the cursor and moves the cursor to its successor.
+    void erase()
+    {
+      this->_checkValid();
+      this->_listPtr->_fingerPtr = nullptr;
+      auto *nextNodePtr = this->_nodePtr->nextPtr;
+      if (this->_nodePtr == this->_listPtr->_headPtr) this->_listPtr->removeHead();
+      else if (this->_nodePtr == this->_listPtr->_tailPtr) this->_listPtr->removeTail();
+      else nextNodePtr = this->_listPtr->_unlink(this->_nodePtr);
+      this->_nodePtr = nextNodePtr;
+    }
+  };
+
+private:
+  void _checkCursor(Cursor &cursor)
+  {
+    if (cursor._listPtr != this) throw std::invalid_argument("Cursor belongs to another list.");
+  }
+
 public:
   uint size() { return this->_size; }
   bool empty() { return this->_size == 0; }
 
-  DoublyLinkedList()
+  // Gives the list a pool of its own, so it cannot splice or merge with any other list.
+  DoublyLinkedList() : DoublyLinkedList(std::make_shared<NodePool<Node>>()) {}
+
+  DoublyLinkedList(std::shared_ptr<NodePool<Node>> poolPtr)
   {
     this->_headPtr = nullptr;
     this->_tailPtr = nullptr;
     this->_size = 0;
+    this->_poolPtr = std::move(poolPtr);
+    this->_fingerPtr = nullptr;
+    this->_fingerIndex = 0;
+  }
+
+  DoublyLinkedList(const DoublyLinkedList &) = delete;
+  DoublyLinkedList &operator=(const DoublyLinkedList &) = delete;
+
+  ~DoublyLinkedList() { this->clear(); }
+
+  void clear()
+  {
+    if (this->_poolPtr.use_count() == 1) this->_poolPtr->release();
+    else
+    {
+      while (this->_headPtr != nullptr)
+      {
+        auto *nextNodePtr = this->_headPtr->nextPtr;
+        this->_poolPtr->destroy(this->_headPtr);
+        this->_headPtr = nextNodePtr;
+      }
+    }
+    this->_headPtr = nullptr;
+    this->_tailPtr = nullptr;
+    this->_size = 0;
+    this->_fingerPtr = nullptr;
   }
 
   void append(int data)
   {
-    auto *newNodePtr = new Node(data);
+    auto *newNodePtr = this->_poolPtr->create(data);
     if (this->empty())
     {
       this->_headPtr = newNodePtr;
@@ -81,7 +361,7 @@ public:
 
   void prepend(int data)
   {
-    auto *newNodePtr = new Node(data);
+    auto *newNodePtr = this->_poolPtr->create(data);
     if (this->empty())
     {
       this->_headPtr = newNodePtr;
@@ -94,6 +374,7 @@ public:
       this->_headPtr = newNodePtr;
     }
     this->_size++;
+    this->_fingerIndex++;
   }
 
   void insertAt(uint index, int data)
@@ -101,31 +382,19 @@ public:
     if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
     else if (index == 0) this->prepend(data);
     else if (index == this->_size - 1) this->append(data);
-    else
-    {
-      auto *newNodePtr = new Node(data);
-      auto *traversalPtr = this->_headPtr;
-      uint i = 0;
-      while (i != index)
-      {
-        traversalPtr = traversalPtr->nextPtr;
-        i++;
-      }
-      newNodePtr->nextPtr = traversalPtr;
-      newNodePtr->previousPtr = traversalPtr->previousPtr;
-      traversalPtr->previousPtr->nextPtr = newNodePtr;
-      traversalPtr->previousPtr = newNodePtr;
-      this->_size++;
-    }
+    else this->_fingerPtr = this->_linkBefore(this->_nodeAt(index), data);
   }
 
   void removeHead()
   {
     if (this->empty()) throw std::runtime_error("List is empty.");
     auto *tempNodePtr = this->_headPtr;
+    if (this->_fingerPtr == tempNodePtr) this->_fingerPtr = nullptr;
+    this->_fingerIndex--;
     this->_headPtr = this->_headPtr->nextPtr;
-    this->_headPtr->previousPtr = nullptr;
-    delete tempNodePtr;
+    if (this->_headPtr == nullptr) this->_tailPtr = nullptr;
+    else this->_headPtr->previousPtr = nullptr;
+    this->_poolPtr->destroy(tempNodePtr);
     this->_size--;
   }
 
@@ -133,31 +402,21 @@ public:
   {
     if (this->empty()) throw std::runtime_error("List is empty.");
     auto *tempNodePtr = this->_tailPtr;
+    if (this->_fingerPtr == tempNodePtr) this->_fingerPtr = nullptr;
     this->_tailPtr = this->_tailPtr->previousPtr;
-    this->_tailPtr->nextPtr = nullptr;
-    delete tempNodePtr;
+    if (this->_tailPtr == nullptr) this->_headPtr = nullptr;
+    else this->_tailPtr->nextPtr = nullptr;
+    this->_poolPtr->destroy(tempNodePtr);
     this->_size--;
   }
 
   void removeAt(uint index)
   {
     if (this->empty()) throw std::runtime_error("List is empty.");
+    else if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
     else if (index == 0) this->removeHead();
     else if (index == this->_size - 1) this->removeTail();
-    else
-    {
-      auto *traversalPtr = this->_headPtr;
-      uint i = 0;
-      while (i != index)
-      {
-        traversalPtr = traversalPtr->nextPtr;
-        i++;
-      }
-      traversalPtr->previousPtr->nextPtr = traversalPtr->nextPtr;
-      traversalPtr->nextPtr->previousPtr = traversalPtr->previousPtr;
-      delete traversalPtr;
-      this->_size--;
-    }
+    else this->_fingerPtr = this->_unlink(this->_nodeAt(index));
   }
 
   int atHead()
@@ -177,14 +436,127 @@ public:
     if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
     else if (index == 0) return this->atHead();
     else if (index == this->_size - 1) return this->atTail();
-    auto *traversalPtr = this->_headPtr;
-    uint i = 0;
-    while (i != index)
+    return this->_nodeAt(index)->data;
+  }
+
+  Cursor cursorAt(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    return Cursor(this, this->_nodeAt(index));
+  }
+
+  // Moves all of `other` in front of index `index`; `index` may equal size().
+  void splice(uint index, DoublyLinkedList &other) { this->splice(index, other, 0, other._size); }
+
+  // Moves the elements at [first, last) of `other` so that they start at `index`.
+  void splice(uint index, DoublyLinkedList &other, uint first, uint last)
+  {
+    this->_checkSharedPool(other);
+    if (index > this->_size || first > last || last > other._size) throw std::out_of_range("Index is out of bounds.");
+    if (first == last) return;
+    auto *firstPtr = other._nodeAt(first);
+    auto *lastPtr = other._nodeAt(last - 1);
+    auto *nextPtr = index == this->_size ? nullptr : this->_nodeAt(index);
+    this->_relink(other, firstPtr, lastPtr, last - first, nextPtr);
+  }
+
+  // Moves all of `other` in front of `position`, or to the tail when `position` has run off the list.
+  void splice(Cursor position, DoublyLinkedList &other)
+  {
+    this->_checkSharedPool(other);
+    this->_checkCursor(position);
+    if (other.empty()) return;
+    this->_relink(other, other._headPtr, other._tailPtr, other._size, position._nodePtr);
+  }
+
+  // Moves the node under `element`, a cursor into `other`, in front of `position`.
+  void splice(Cursor position, DoublyLinkedList &other, Cursor element)
+  {
+    this->_checkSharedPool(other);
+    this->_checkCursor(position);
+    other._checkCursor(element);
+    element._checkValid();
+    this->_relink(other, element._nodePtr, element._nodePtr, 1, position._nodePtr);
+  }
+
+  // Moves the nodes of `other` from `first` up to but not including `last` in front of `position`. A `last`
+  // that has run off the list stands for the end of `other`.
+  void splice(Cursor position, DoublyLinkedList &other, Cursor first, Cursor last)
+  {
+    this->_checkSharedPool(other);
+    this->_checkCursor(position);
+    other._checkCursor(first);
+    other._checkCursor(last);
+    if (first._nodePtr == last._nodePtr) return;
+    first._checkValid();
+    uint count = 1;
+    auto *lastPtr = first._nodePtr;
+    while (lastPtr->nextPtr != last._nodePtr)
     {
-      traversalPtr = traversalPtr->nextPtr;
-      i++;
+      if (lastPtr->nextPtr == nullptr) throw std::invalid_argument("Cursors do not form a range.");
+      lastPtr = lastPtr->nextPtr;
+      count++;
     }
-    return traversalPtr->data;
+    this->_relink(other, first._nodePtr, lastPtr, count, position._nodePtr);
+  }
+
+  // Merges the sorted list `other` into this sorted list, leaving `other` empty.
+  void merge(DoublyLinkedList &other)
+  {
+    this->_checkSharedPool(other);
+    if (other.empty()) return;
+    this->_headPtr = _mergeChains(this->_headPtr, other._headPtr, this->_tailPtr);
+    this->_relinkPrevious();
+    this->_size += other._size;
+    this->_fingerPtr = nullptr;
+    other._headPtr = nullptr;
+    other._tailPtr = nullptr;
+    other._size = 0;
+    other._fingerPtr = nullptr;
+  }
+
+  // Stable bottom-up merge sort: merges runs of 1, 2, 4, ... nodes in place, using O(1) extra space.
+  void sort()
+  {
+    if (this->_size < 2) return;
+    for (uint width = 1; width < this->_size; width *= 2)
+    {
+      auto *remainingPtr = this->_headPtr;
+      Node *sortedHeadPtr = nullptr;
+      Node *sortedTailPtr = nullptr;
+      while (remainingPtr != nullptr)
+      {
+        auto *leftPtr = remainingPtr;
+        auto *rightPtr = _cut(leftPtr, width);
+        remainingPtr = _cut(rightPtr, width);
+        Node *runTailPtr;
+        auto *runPtr = _mergeChains(leftPtr, rightPtr, runTailPtr);
+        if (sortedTailPtr == nullptr) sortedHeadPtr = runPtr;
+        else sortedTailPtr->nextPtr = runPtr;
+        sortedTailPtr = runTailPtr;
+      }
+      this->_headPtr = sortedHeadPtr;
+      this->_tailPtr = sortedTailPtr;
+    }
+    this->_relinkPrevious();
+    this->_fingerPtr = nullptr;
+  }
+
+  void saveSnapshot(const std::string &path)
+  {
+    snapshot::Writer<int> writer(path, this->_size, this->_size);
+    for (auto *traversalPtr = this->_headPtr; traversalPtr != nullptr; traversalPtr = traversalPtr->nextPtr)
+      writer.append(traversalPtr->data);
+    writer.finish();
+  }
+
+  void loadSnapshot(const std::string &path)
+  {
+    snapshot::View<int> view(path);
+    this->clear();
+    this->_poolPtr->reserve(view.count());
+    auto *elementsPtr = view.data();
+    for (uint i = 0; i < view.count(); i++) this->append(elementsPtr[i]);
   }
 
   void toString()
@@ -202,6 +574,9 @@ public:
   }
 };
 
+#ifndef DSA_NO_MAIN
+#include <vector>
+
 int main()
 {
   DoublyLinkedList list;
@@ -228,5 +603,207 @@ int main()
   list.removeAt(1);
   list.toString();
 
+  auto poolPtr = std::make_shared<NodePool<Node>>();
+  DoublyLinkedList first(poolPtr);
+  DoublyLinkedList second(poolPtr);
+
+  for (int i = 0; i < 300; i++) first.append(i);
+  assert(poolPtr->slabs() == 2);
+  while (!first.empty()) first.removeTail();
+
+  for (int i = 0; i < 300; i++) second.prepend(i);
+  assert(poolPtr->slabs() == 2);
+  assert(poolPtr->nodes() == 300);
+  assert(second.atHead() == 299 && second.atTail() == 0);
+
+  second.clear();
+  assert(poolPtr->nodes() == 0);
+  assert(poolPtr->slabs() == 2);
+
+  list.clear();
+  assert(list.empty() == true);
+  list.append(1);
+  list.removeHead();
+  assert(list.empty() == true);
+
+  for (int i = 0; i < 10; i++) list.append(i);
+  int sum = 0;
+  for (uint i = 0; i < list.size(); i++) sum += list.at(i);
+  assert(sum == 45);
+  list.insertAt(5, 50);
+  list.removeAt(2);
+  list.prepend(-1);
+  assert(list.at(5) == 50 && list.at(6) == 5 && list.at(2) == 1 && list.at(3) == 3);
+  list.removeHead();
+  list.removeAt(4);
+  assert(list.at(4) == 5 && list.at(8) == 9);
+
+  auto cursor = list.cursorAt(4);
+  cursor.insertBefore(40);
+  cursor.insertAfter(60);
+  assert(cursor.get() == 5);
+  cursor.advance(-1);
+  assert(cursor.get() == 40);
+  cursor.erase();
+  assert(cursor.get() == 5 && list.at(4) == 5 && list.at(5) == 60);
+  cursor.get() = 55;
+  assert(list.at(4) == 55);
+
+  auto head = list.cursorAt(0);
+  head.insertBefore(-5);
+  head.erase();
+  assert(list.atHead() == -5 && list.at(1) == 1);
+  head.previous();
+  head.erase();
+  assert(list.atHead() == 1 && head.get() == 1);
+
+  auto tail = list.cursorAt(list.size() - 1);
+  tail.insertAfter(100);
+  tail.next();
+  tail.erase();
+  assert(tail.valid() == false && list.atTail() == 9);
+
+  DoublyLinkedList mixed;
+  std::vector<int> expected;
+  for (int i = 0; i < 64; i++)
+  {
+    mixed.append(i);
+    expected.push_back(i);
+  }
+  for (uint i = 0; i < 2000; i++)
+  {
+    auto index = (i * 7919) % (expected.size() - 2) + 1;
+    if (i % 3 == 0)
+    {
+      mixed.removeAt(index);
+      expected.erase(expected.begin() + index);
+    }
+    else if (i % 3 == 1)
+    {
+      mixed.insertAt(index, i);
+      expected.insert(expected.begin() + index, i);
+    }
+    else
+    {
+      mixed.prepend(i);
+      expected.insert(expected.begin(), i);
+    }
+    assert(mixed.at(index) == expected[index]);
+  }
+  for (uint i = 0; i < expected.size(); i++) assert(mixed.at(i) == expected[i]);
+
+  DoublyLinkedList source(poolPtr);
+  DoublyLinkedList target(poolPtr);
+
+  for (int i = 0; i < 6; i++) source.append(i);
+  target.append(100);
+  target.append(101);
+  target.splice(1, source, 2, 5);
+  assert(target.size() == 5 && source.size() == 3);
+  assert(target.at(0) == 100 && target.at(1) == 2 && target.at(3) == 4 && target.atTail() == 101);
+  assert(source.at(1) == 1 && source.atTail() == 5);
+  target.splice(target.size(), source, 2, 3);
+  assert(target.atTail() == 5 && source.atTail() == 1);
+  target.splice(0, source);
+  assert(source.empty() == true && target.atHead() == 0 && target.size() == 8);
+  assert(poolPtr->nodes() == 8);
+
+  target.sort();
+  int sorted[] = {0, 1, 2, 3, 4, 5, 100, 101};
+  for (uint i = 0; i < 8; i++) assert(target.at(i) == sorted[i]);
+
+  for (int i = 0; i < 10; i++) source.append(i * 20);
+  target.merge(source);
+  assert(target.size() == 18 && source.empty() == true);
+  for (uint i = 1; i < target.size(); i++) assert(target.at(i - 1) <= target.at(i));
+  assert(target.atHead() == 0 && target.atTail() == 180);
+  target.removeTail();
+  assert(target.atTail() == 160);
+
+  DoublyLinkedList large(poolPtr);
+  for (int i = 0; i < 1000; i++) large.append((i * 7919) % 1009);
+  auto nodes = poolPtr->nodes();
+  large.sort();
+  assert(poolPtr->nodes() == nodes);
+  for (uint i = 1; i < large.size(); i++) assert(large.at(i - 1) <= large.at(i));
+  auto backwards = large.cursorAt(large.size() - 1);
+  for (uint i = 1; i < large.size(); i++) backwards.previous();
+  assert(backwards.get() == large.atHead());
+
+  // The same moves through cursors: one node, a range, and a whole list at the end.
+  DoublyLinkedList left(poolPtr);
+  DoublyLinkedList right(poolPtr);
+  for (int i = 0; i < 4; i++) left.append(i);
+  for (int i = 0; i < 6; i++) right.append(10 + i);
+  left.splice(left.cursorAt(1), right, right.cursorAt(3));
+  assert(left.size() == 5 && left.at(1) == 13 && left.at(2) == 1 && right.size() == 5 && right.at(3) == 14);
+  left.splice(left.cursorAt(left.size() - 1), right, right.cursorAt(1), right.cursorAt(3));
+  assert(left.size() == 7 && left.at(4) == 11 && left.at(5) == 12 && left.atTail() == 3);
+  assert(right.size() == 3 && right.atHead() == 10 && right.at(1) == 14 && right.atTail() == 15);
+  auto rightEnd = right.cursorAt(right.size() - 1);
+  rightEnd.next();
+  left.splice(left.cursorAt(0), right, right.cursorAt(1), rightEnd);
+  assert(left.atHead() == 14 && left.at(1) == 15 && right.size() == 1 && right.atTail() == 10);
+  auto leftEnd = left.cursorAt(left.size() - 1);
+  leftEnd.next();
+  left.splice(leftEnd, right);
+  assert(right.empty() == true && left.size() == 10 && left.atTail() == 10);
+  int spliced[] = {14, 15, 0, 13, 1, 2, 11, 12, 3, 10};
+  for (uint i = 0; i < 10; i++) assert(left.at(i) == spliced[i]);
+  auto fromTail = left.cursorAt(left.size() - 1);
+  for (int i = 9; i >= 0; i--, fromTail.previous()) assert(fromTail.get() == spliced[i]);
+
+  bool isForeign = false;
+  try
+  {
+    right.append(20);
+    left.splice(right.cursorAt(0), right);
+  }
+  catch (const std::invalid_argument &)
+  {
+    isForeign = true;
+  }
+  assert(isForeign == true);
+  left.clear();
+  right.clear();
+
+  DoublyLinkedList separate;
+  bool threw = false;
+  try
+  {
+    separate.merge(large);
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw == true);
+
+  char pathTemplate[] = "/tmp/DoublyLinkedList.snapshot.XXXXXX";
+  auto fileDescriptor = mkstemp(pathTemplate);
+  assert(fileDescriptor != -1);
+  close(fileDescriptor);
+  const std::string path = pathTemplate;
+  DoublyLinkedList saved;
+  for (int i = 0; i < 1000; i++) saved.append(1000 - i);
+  saved.saveSnapshot(path);
+
+  auto snapshotPoolPtr = std::make_shared<NodePool<Node>>();
+  DoublyLinkedList restored(snapshotPoolPtr);
+  restored.append(-1);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 1000 && snapshotPoolPtr->slabs() == 2);
+  assert(restored.atHead() == 1000 && restored.atTail() == 1);
+  for (uint i = 0; i < restored.size(); i++) assert(restored.at(i) == 1000 - (int)i);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 1000 && restored.at(999) == 1 && snapshotPoolPtr->slabs() == 2);
+
+  DoublyLinkedList empty;
+  empty.saveSnapshot(path);
+  restored.loadSnapshot(path);
+  assert(restored.empty() == true);
+  unlink(path.c_str());
+
   return 0;
 }
+#endif
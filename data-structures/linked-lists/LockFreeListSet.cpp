@@ -0,0 +1,402 @@
+/*
+  Data Structures | Lock-Free List Set
+
+  This set will only cover `int` data types.
+
+  A sorted singly-linked list used as a set that any number of threads can
+  `insert` into, `remove` from and query at once without a lock (the
+  Harris-Michael list). Each link is an atomic word whose low bit marks its
+  own node as deleted. `remove` first sets the mark on the node's link,
+  which is the moment the key leaves the set, and then unlinks the node
+  with a compare-and-swap on its predecessor. The traversals of `insert`
+  and `remove` unlink the marked nodes they pass, so a remove whose unlink lost a race is finished
+  by whoever comes next. Because a marked link can no longer be swapped,
+  nothing can be inserted behind a node that is being removed.
+
+  `contains` is the Herlihy-Shavit wait-free search: it walks from the
+  head to the first node whose data is not less than the key, stepping
+  over marked nodes without unlinking them and without ever starting
+  over, and reports the key as present if that node holds it and is not
+  marked. It never writes to the list, and the steps it takes are bounded
+  by the nodes it passes.
+
+  Unlinked nodes are retired through epoch-based reclamation (see
+  `common/EpochReclamation.hpp`). Every operation pins the domain, and no
+  node it can reach is deleted before it finishes, so a traversal never
+  has to re-check that the node it steps onto is still linked. Hazard
+  pointers could not give `contains` that: a reader must restart whenever
+  the node it protected turns out to be unlinked. The trade-off is that a
+  thread preempted in the middle of an operation delays every deletion
+  until it resumes.
+
+  `toString()` must not run concurrently with other operations.
+
+  --- Time Complexities ---
+  | Insert         | O(n) |
+  | Remove         | O(n) |
+  | Search         | O(n) |
+  -------------------------
+*/
+
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <cstdint>
+#include "../common/EpochReclamation.hpp"
+
+class LockFreeSetNode
+{
+public:
+  int data;
+  std::atomic<std::uintptr_t> nextWord;
+
+  LockFreeSetNode(int data)
+  {
+    this->data = data;
+    this->nextWord.store(0, std::memory_order_relaxed);
+  }
+};
+
+class LockFreeListSet
+{
+private:
+  typedef unsigned int uint;
+  typedef std::uintptr_t Word;
+  typedef EpochReclamation<> Domain;
+  alignas(64) std::atomic<Word> _headWord;
+  Domain _epochs;
+
+  static LockFreeSetNode *_nodeOf(Word word) { return reinterpret_cast<LockFreeSetNode *>(word & ~Word(1)); }
+  static Word _wordOf(LockFreeSetNode *nodePtr) { return reinterpret_cast<Word>(nodePtr); }
+  static bool _isMarked(Word word) { return (word & 1) != 0; }
+
+  enum FindResult
+  {
+    Found,
+    Missing,
+    Restart
+  };
+
+  // One pass of `_find`. Returns Restart when unlinking a marked node fails because its predecessor changed.
+  FindResult _tryFind(int data, Domain::Guard &guard, std::atomic<Word> *&previousPtr, LockFreeSetNode *&currentPtr,
+                      LockFreeSetNode *&nextPtr)
+  {
+    previousPtr = &this->_headWord;
+    currentPtr = _nodeOf(previousPtr->load(std::memory_order_acquire));
+    while (true)
+    {
+      if (currentPtr == nullptr) return Missing;
+      auto nextWord = currentPtr->nextWord.load(std::memory_order_acquire);
+      nextPtr = _nodeOf(nextWord);
+      if (_isMarked(nextWord))
+      {
+        auto expected = _wordOf(currentPtr);
+        if (!previousPtr->compare_exchange_strong(expected, _wordOf(nextPtr), std::memory_order_acq_rel,
+                                                  std::memory_order_acquire))
+          return Restart;
+        guard.retire(currentPtr);
+      }
+      else
+      {
+        if (currentPtr->data >= data) return currentPtr->data == data ? Found : Missing;
+        previousPtr = &currentPtr->nextWord;
+      }
+      currentPtr = nextPtr;
+    }
+  }
+
+  // Finds the first node whose data is not less than `data`, unlinking marked nodes on the way. On return
+  // `previousPtr` is the link that pointed at `currentPtr`.
+  bool _find(int data, Domain::Guard &guard, std::atomic<Word> *&previousPtr, LockFreeSetNode *&currentPtr,
+             LockFreeSetNode *&nextPtr)
+  {
+    auto result = Restart;
+    while (result == Restart) result = this->_tryFind(data, guard, previousPtr, currentPtr, nextPtr);
+    return result == Found;
+  }
+
+public:
+  bool empty() { return _nodeOf(this->_headWord.load(std::memory_order_acquire)) == nullptr; }
+
+  LockFreeListSet() { this->_headWord.store(0, std::memory_order_relaxed); }
+
+  LockFreeListSet(const LockFreeListSet &) = delete;
+  LockFreeListSet &operator=(const LockFreeListSet &) = delete;
+
+  // No thread may use the set while it is destroyed.
+  ~LockFreeListSet()
+  {
+    auto *nodePtr = _nodeOf(this->_headWord.load(std::memory_order_acquire));
+    while (nodePtr != nullptr)
+    {
+      auto *nextNodePtr = _nodeOf(nodePtr->nextWord.load(std::memory_order_relaxed));
+      delete nodePtr;
+      nodePtr = nextNodePtr;
+    }
+  }
+
+  // Returns false if `data` was already in the set.
+  bool insert(int data)
+  {
+    Domain::Guard guard(this->_epochs);
+    LockFreeSetNode *newNodePtr = nullptr;
+    std::atomic<Word> *previousPtr;
+    LockFreeSetNode *currentPtr, *nextPtr;
+    while (true)
+    {
+      if (this->_find(data, guard, previousPtr, currentPtr, nextPtr))
+      {
+        delete newNodePtr;
+        return false;
+      }
+      if (newNodePtr == nullptr) newNodePtr = new LockFreeSetNode(data);
+      newNodePtr->nextWord.store(_wordOf(currentPtr), std::memory_order_relaxed);
+      auto expected = _wordOf(currentPtr);
+      if (previousPtr->compare_exchange_strong(expected, _wordOf(newNodePtr), std::memory_order_release,
+                                               std::memory_order_relaxed))
+        return true;
+    }
+  }
+
+  // Returns false if `data` was not in the set.
+  bool remove(int data)
+  {
+    Domain::Guard guard(this->_epochs);
+    std::atomic<Word> *previousPtr;
+    LockFreeSetNode *currentPtr, *nextPtr;
+    while (true)
+    {
+      if (!this->_find(data, guard, previousPtr, currentPtr, nextPtr)) return false;
+      auto nextWord = _wordOf(nextPtr);
+      if (!currentPtr->nextWord.compare_exchange_strong(nextWord, nextWord | 1, std::memory_order_acq_rel,
+                                                        std::memory_order_relaxed))
+        continue;
+      auto expected = _wordOf(currentPtr);
+      if (previousPtr->compare_exchange_strong(expected, _wordOf(nextPtr), std::memory_order_acq_rel,
+                                               std::memory_order_relaxed))
+        guard.retire(currentPtr);
+      else this->_find(data, guard, previousPtr, currentPtr, nextPtr);
+      return true;
+    }
+  }
+
+  // Wait-free: takes one step per node it passes and never restarts or writes.
+  bool contains(int data)
+  {
+    Domain::Guard guard(this->_epochs);
+    auto *currentPtr = _nodeOf(this->_headWord.load(std::memory_order_acquire));
+    while (currentPtr != nullptr && currentPtr->data < data)
+      currentPtr = _nodeOf(currentPtr->nextWord.load(std::memory_order_acquire));
+    return currentPtr != nullptr && currentPtr->data == data &&
+           !_isMarked(currentPtr->nextWord.load(std::memory_order_acquire));
+  }
+
+  void toString()
+  {
+    auto *traversalPtr = _nodeOf(this->_headWord.load(std::memory_order_acquire));
+    if (traversalPtr == nullptr)
+    {
+      std::cout << "Set is empty." << std::endl;
+      return;
+    }
+    while (traversalPtr != nullptr)
+    {
+      auto nextWord = traversalPtr->nextWord.load(std::memory_order_relaxed);
+      if (!_isMarked(nextWord)) std::cout << traversalPtr->data << " -> ";
+      traversalPtr = _nodeOf(nextWord);
+    }
+    std::cout << "null" << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// One completed operation on a single key. `invoked` and `responded` come from one shared counter, so they
+// order events across threads the way they happened.
+struct SetEvent
+{
+  int operation;
+  bool result;
+  unsigned long long invoked;
+  unsigned long long responded;
+};
+
+// Checks that the per-thread histories of one key can be merged into a sequential history of a set that
+// returns the same results, with every operation taking effect between its invocation and its response. Each
+// thread's events are already in order, so a candidate linearization is a prefix of every thread's history
+// plus whether the key is in the set; the search visits each such state once.
+bool isLinearizable(const std::vector<std::vector<SetEvent>> &histories)
+{
+  typedef unsigned long long State;
+  auto threads = histories.size();
+  auto indexOf = [](State state, size_t t) { return (uint)(state >> (1 + 15 * t)) & 0x7fff; };
+  std::vector<State> pending = {0};
+  std::unordered_set<State> visited = {0};
+  while (!pending.empty())
+  {
+    auto state = pending.back();
+    pending.pop_back();
+    bool isMember = state & 1;
+    bool isDone = true;
+    for (size_t t = 0; t < threads; t++)
+    {
+      auto index = indexOf(state, t);
+      if (index == histories[t].size()) continue;
+      isDone = false;
+      auto &event = histories[t][index];
+      // An event can go next only if no other thread's next event responded before it was invoked.
+      bool isMinimal = true;
+      for (size_t u = 0; u < threads; u++)
+      {
+        auto otherIndex = indexOf(state, u);
+        if (u != t && otherIndex < histories[u].size() && histories[u][otherIndex].responded < event.invoked)
+          isMinimal = false;
+      }
+      if (!isMinimal) continue;
+      bool expected = event.operation == 0 ? !isMember : isMember;
+      if (event.result != expected) continue;
+      bool nextIsMember = event.operation == 0 ? true : event.operation == 1 ? false : isMember;
+      auto nextState = ((state + (State(1) << (1 + 15 * t))) & ~State(1)) | nextIsMember;
+      if (visited.insert(nextState).second) pending.push_back(nextState);
+    }
+    if (isDone) return true;
+  }
+  return false;
+}
+
+int main()
+{
+  LockFreeListSet set;
+
+  assert(set.insert(5) == true);
+  assert(set.insert(1) == true);
+  assert(set.insert(3) == true);
+  assert(set.insert(3) == false);
+
+  assert(set.contains(1) == true);
+  assert(set.contains(2) == false);
+  assert(set.contains(5) == true);
+
+  set.toString();
+
+  assert(set.remove(3) == true);
+  assert(set.remove(3) == false);
+  assert(set.contains(3) == false);
+  assert(set.remove(1) == true);
+  assert(set.remove(5) == true);
+  assert(set.empty() == true);
+
+  const int threads = 4;
+  const int operations = 40000;
+
+  // Disjoint keys: each thread owns the keys equal to its index modulo `threads`, so it alone decides their
+  // membership and every result it sees must match a sequential run, however the threads interleave.
+  {
+    LockFreeListSet shared;
+    std::vector<std::thread> workers;
+    std::vector<int> mismatches(threads, 0);
+    for (int t = 0; t < threads; t++)
+    {
+      workers.emplace_back([&, t] {
+        const int keys = 64;
+        std::vector<bool> isMember(keys, false);
+        uint seed = t + 1;
+        for (int i = 0; i < operations; i++)
+        {
+          seed = seed * 1103515245 + 12345;
+          auto slot = (seed >> 8) % keys;
+          auto key = (int)slot * threads + t;
+          switch ((seed >> 20) % 3)
+          {
+          case 0:
+            mismatches[t] += shared.insert(key) != !isMember[slot];
+            isMember[slot] = true;
+            break;
+          case 1:
+            mismatches[t] += shared.remove(key) != isMember[slot];
+            isMember[slot] = false;
+            break;
+          default:
+            mismatches[t] += shared.contains(key) != isMember[slot];
+          }
+        }
+        for (int slot = 0; slot < keys; slot++) mismatches[t] += shared.contains(slot * threads + t) != isMember[slot];
+      });
+    }
+    for (auto &worker : workers) worker.join();
+    for (auto count : mismatches) assert(count == 0);
+  }
+
+  // Shared keys: all threads fight over the same few keys. For each key, the successful inserts minus the
+  // successful removes must equal its final membership, which holds for every linearizable history.
+  {
+    LockFreeListSet shared;
+    const int keys = 8;
+    std::vector<std::vector<int>> balances(threads, std::vector<int>(keys, 0));
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+      workers.emplace_back([&, t] {
+        uint seed = 7 * t + 3;
+        for (int i = 0; i < operations; i++)
+        {
+          seed = seed * 1103515245 + 12345;
+          auto key = (int)((seed >> 8) % keys);
+          if ((seed >> 20) & 1) balances[t][key] += shared.insert(key);
+          else balances[t][key] -= shared.remove(key);
+        }
+      });
+    }
+    for (auto &worker : workers) worker.join();
+    for (int key = 0; key < keys; key++)
+    {
+      int balance = 0;
+      for (int t = 0; t < threads; t++) balance += balances[t][key];
+      assert(balance == (shared.contains(key) ? 1 : 0));
+    }
+  }
+
+  // Histories: all threads insert, remove and look up the same few keys, recording when each call started
+  // and returned. Linearizability is local, so each key's history must linearize on its own.
+  {
+    LockFreeListSet shared;
+    const int keys = 4;
+    const int events = 3000;
+    std::atomic<unsigned long long> clock(0);
+    std::vector<std::vector<std::vector<SetEvent>>> histories(keys, std::vector<std::vector<SetEvent>>(threads));
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+      workers.emplace_back([&, t] {
+        uint seed = 11 * t + 5;
+        for (int i = 0; i < events; i++)
+        {
+          seed = seed * 1103515245 + 12345;
+          auto key = (int)((seed >> 8) % keys);
+          auto operation = (int)((seed >> 20) % 3);
+          SetEvent event;
+          event.operation = operation;
+          event.invoked = clock.fetch_add(1);
+          if (operation == 0) event.result = shared.insert(key);
+          else if (operation == 1) event.result = shared.remove(key);
+          else event.result = shared.contains(key);
+          event.responded = clock.fetch_add(1);
+          histories[key][t].push_back(event);
+        }
+      });
+    }
+    for (auto &worker : workers) worker.join();
+    for (int key = 0; key < keys; key++) assert(isLinearizable(histories[key]));
+
+    // The checker itself must reject a history no set could produce: two inserts of an absent key that both
+    // succeed one after the other.
+    std::vector<std::vector<SetEvent>> impossible = {{{0, true, 0, 1}}, {{0, true, 2, 3}}};
+    assert(isLinearizable(impossible) == false);
+  }
+
+  return 0;
+}
+#endif
@@ -3,22 +3,42 @@
 
   This singly-linked list will only cover `int` data types.
 
-  ---- Time Complexities  ----
-  | Append at head    | O(1) |
-  | Append at tail    | O(1) |
-  | Insert at index i | O(n) |
-  | Delete at head    | O(1) |
-  | Delete at tail    | O(1) |
-  | Delete at index i | O(n) |
-  | Search            | O(n) |
-  | Access head       | O(1) |
-  | Access tail       | O(1) |
-  | Access index i    | O(n) |
-  ----------------------------
+  Nodes come from a `NodePool` (see `common/NodePool.hpp`) rather than from
+  `new`/`delete`. By default each list owns its pool. Lists constructed with
+  the same pool share its slabs and free list, and `clear()` on a list that
+  owns its pool alone frees every node at once.
+
+  `splice`, `merge` and `sort` only relink existing nodes and never
+  allocate. Because a node must go back to the pool it came from, nodes can
+  only move between lists that share a pool.
+
+  `saveSnapshot` writes the elements head to tail (see
+  `common/Snapshot.hpp`). `loadSnapshot` replaces the list with them,
+  taking every node from a single pool allocation and reading the
+  elements straight out of the mapped file.
+
+  ------- Time Complexities  -------
+  | Append at head    | O(1)       |
+  | Append at tail    | O(1)       |
+  | Insert at index i | O(n)       |
+  | Delete at head    | O(1)       |
+  | Delete at tail    | O(1)       |
+  | Delete at index i | O(n)       |
+  | Search            | O(n)       |
+  | Access head       | O(1)       |
+  | Access tail       | O(1)       |
+  | Access index i    | O(n)       |
+  | Splice k at i     | O(n)       |
+  | Merge sorted      | O(n)       |
+  | Sort              | O(n log n) |
+  ----------------------------------
 */
 
 #include <iostream>
 #include <cassert>
+#include <memory>
+#include "../common/NodePool.hpp"
+#include "../common/Snapshot.hpp"
 
 class Node
 {
@@ -46,14 +66,83 @@ private:
   Node *_headPtr;
   Node *_tailPtr;
   uint _size;
+  std::shared_ptr<NodePool<Node>> _poolPtr;
   bool _isIndexOutOfBounds(uint index) { return index < 0 || index >= this->_size; }
 
+  Node *_nodeAt(uint index)
+  {
+    if (index == this->_size - 1) return this->_tailPtr;
+    auto *traversalPtr = this->_headPtr;
+    for (uint i = 0; i != index; i++) traversalPtr = traversalPtr->nextPtr;
+    return traversalPtr;
+  }
+
+  void _checkSharedPool(SinglyLinkedList &other)
+  {
+    if (&other == this) throw std::invalid_argument("Cannot move nodes within the same list.");
+    if (other._poolPtr != this->_poolPtr) throw std::invalid_argument("Lists must share a node pool.");
+  }
+
+  // Cuts the chain after its first `count` nodes and returns the rest.
+  static Node *_cut(Node *nodePtr, uint count)
+  {
+    for (uint i = 1; i < count && nodePtr != nullptr; i++) nodePtr = nodePtr->nextPtr;
+    if (nodePtr == nullptr) return nullptr;
+    auto *restPtr = nodePtr->nextPtr;
+    nodePtr->nextPtr = nullptr;
+    return restPtr;
+  }
+
+  // Merges two sorted chains, taking from `leftPtr` on ties so the merge is stable.
+  static Node *_mergeChains(Node *leftPtr, Node *rightPtr, Node *&tailPtr)
+  {
+    Node *headPtr = nullptr;
+    Node **linkPtr = &headPtr;
+    tailPtr = nullptr;
+    while (leftPtr != nullptr && rightPtr != nullptr)
+    {
+      auto *&smallerPtr = rightPtr->data < leftPtr->data ? rightPtr : leftPtr;
+      *linkPtr = smallerPtr;
+      tailPtr = smallerPtr;
+      linkPtr = &smallerPtr->nextPtr;
+      smallerPtr = smallerPtr->nextPtr;
+    }
+    *linkPtr = leftPtr != nullptr ? leftPtr : rightPtr;
+    for (auto *restPtr = *linkPtr; restPtr != nullptr; restPtr = restPtr->nextPtr) tailPtr = restPtr;
+    return headPtr;
+  }
+
 public:
   uint size() { return this->_size; }
   bool empty() { return this->_size == 0; }
 
-  SinglyLinkedList()
+  SinglyLinkedList() : SinglyLinkedList(std::make_shared<NodePool<Node>>()) {}
+
+  SinglyLinkedList(std::shared_ptr<NodePool<Node>> poolPtr)
+  {
+    this->_headPtr = nullptr;
+    this->_tailPtr = nullptr;
+    this->_size = 0;
+    this->_poolPtr = std::move(poolPtr);
+  }
+
+  SinglyLinkedList(const SinglyLinkedList &) = delete;
+  SinglyLinkedList &operator=(const SinglyLinkedList &) = delete;
+
+  ~SinglyLinkedList() { this->clear(); }
+
+  void clear()
   {
+    if (this->_poolPtr.use_count() == 1) this->_poolPtr->release();
+    else
+    {
+      while (this->_headPtr != nullptr)
+      {
+        auto *nextNodePtr = this->_headPtr->nextPtr;
+        this->_poolPtr->destroy(this->_headPtr);
+        this->_headPtr = nextNodePtr;
+      }
+    }
     this->_headPtr = nullptr;
     this->_tailPtr = nullptr;
     this->_size = 0;
@@ -61,7 +150,7 @@ public:
 
   void append(int data)
   {
-    auto *newNodePtr = new Node(data);
+    auto *newNodePtr = this->_poolPtr->create(data);
     if (this->_size == 0)
     {
       this->_headPtr = newNodePtr;
@@ -77,7 +166,7 @@ public:
 
   void prepend(int data)
   {
-    auto *newNodePtr = new Node(data);
+    auto *newNodePtr = this->_poolPtr->create(data);
     if (this->_size == 0)
     {
       this->_headPtr = newNodePtr;
@@ -97,7 +186,7 @@ public:
     if (index == 0) this->prepend(data);
     else
     {
-      auto *newNodePtr = new Node(data);
+      auto *newNodePtr = this->_poolPtr->create(data);
       auto *traversalPtr = this->_headPtr;
       uint i = 0;
       while (i + 1 != index)
@@ -115,8 +204,9 @@ public:
   {
     if (this->_size == 0) throw std::runtime_error("List is empty.");
     auto *tempNodePtr = this->_headPtr->nextPtr;
-    delete this->_headPtr;
+    this->_poolPtr->destroy(this->_headPtr);
     this->_headPtr = tempNodePtr;
+    if (this->_headPtr == nullptr) this->_tailPtr = nullptr;
     this->_size--;
   }
 
@@ -124,16 +214,21 @@ public:
   {
     if (this->_size == 0)
       throw std::runtime_error("List is empty.");
+    if (this->_size == 1)
+    {
+      this->removeHead();
+      return;
+    }
     auto *traversalPtr = this->_headPtr;
     while (traversalPtr->nextPtr != this->_tailPtr)
       traversalPtr = traversalPtr->nextPtr;
-    delete this->_tailPtr;
+    this->_poolPtr->destroy(this->_tailPtr);
     this->_tailPtr = traversalPtr;
     this->_tailPtr->nextPtr = nullptr;
     this->_size--;
   }
 
-  void removeAt(int index)
+  void removeAt(uint index)
   {
     if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
     else if (index == 0) this->removeHead();
@@ -148,7 +243,7 @@ public:
         i++;
       }
       auto *tempNodePtr = traversalPtr->nextPtr->nextPtr;
-      delete traversalPtr->nextPtr;
+      this->_poolPtr->destroy(traversalPtr->nextPtr);
       traversalPtr->nextPtr = tempNodePtr;
       this->_size--;
     }
@@ -181,6 +276,92 @@ public:
     return traversalPtr->data;
   }
 
+  // Moves all of `other` in front of index `index`; `index` may equal size().
+  void splice(uint index, SinglyLinkedList &other) { this->splice(index, other, 0, other._size); }
+
+  // Moves the elements at [first, last) of `other` so that they start at `index`.
+  void splice(uint index, SinglyLinkedList &other, uint first, uint last)
+  {
+    this->_checkSharedPool(other);
+    if (index > this->_size || first > last || last > other._size) throw std::out_of_range("Index is out of bounds.");
+    if (first == last) return;
+    auto *beforeFirstPtr = first == 0 ? nullptr : other._nodeAt(first - 1);
+    auto *firstPtr = beforeFirstPtr == nullptr ? other._headPtr : beforeFirstPtr->nextPtr;
+    auto *lastPtr = other._nodeAt(last - 1);
+    if (beforeFirstPtr == nullptr) other._headPtr = lastPtr->nextPtr;
+    else beforeFirstPtr->nextPtr = lastPtr->nextPtr;
+    if (lastPtr == other._tailPtr) other._tailPtr = beforeFirstPtr;
+    other._size -= last - first;
+
+    if (index == 0)
+    {
+      lastPtr->nextPtr = this->_headPtr;
+      this->_headPtr = firstPtr;
+      if (this->_tailPtr == nullptr) this->_tailPtr = lastPtr;
+    }
+    else
+    {
+      auto *beforePtr = this->_nodeAt(index - 1);
+      lastPtr->nextPtr = beforePtr->nextPtr;
+      beforePtr->nextPtr = firstPtr;
+      if (beforePtr == this->_tailPtr) this->_tailPtr = lastPtr;
+    }
+    this->_size += last - first;
+  }
+
+  // Merges the sorted list `other` into this sorted list, leaving `other` empty.
+  void merge(SinglyLinkedList &other)
+  {
+    this->_checkSharedPool(other);
+    if (other.empty()) return;
+    this->_headPtr = _mergeChains(this->_headPtr, other._headPtr, this->_tailPtr);
+    this->_size += other._size;
+    other._headPtr = nullptr;
+    other._tailPtr = nullptr;
+    other._size = 0;
+  }
+
+  // Stable bottom-up merge sort: merges runs of 1, 2, 4, ... nodes in place, using O(1) extra space.
+  void sort()
+  {
+    for (uint width = 1; width < this->_size; width *= 2)
+    {
+      auto *remainingPtr = this->_headPtr;
+      Node *sortedHeadPtr = nullptr;
+      Node *sortedTailPtr = nullptr;
+      while (remainingPtr != nullptr)
+      {
+        auto *leftPtr = remainingPtr;
+        auto *rightPtr = _cut(leftPtr, width);
+        remainingPtr = _cut(rightPtr, width);
+        Node *runTailPtr;
+        auto *runPtr = _mergeChains(leftPtr, rightPtr, runTailPtr);
+        if (sortedTailPtr == nullptr) sortedHeadPtr = runPtr;
+        else sortedTailPtr->nextPtr = runPtr;
+        sortedTailPtr = runTailPtr;
+      }
+      this->_headPtr = sortedHeadPtr;
+      this->_tailPtr = sortedTailPtr;
+    }
+  }
+
+  void saveSnapshot(const std::string &path)
+  {
+    snapshot::Writer<int> writer(path, this->_size, this->_size);
+    for (auto *traversalPtr = this->_headPtr; traversalPtr != nullptr; traversalPtr = traversalPtr->nextPtr)
+      writer.append(traversalPtr->data);
+    writer.finish();
+  }
+
+  void loadSnapshot(const std::string &path)
+  {
+    snapshot::View<int> view(path);
+    this->clear();
+    this->_poolPtr->reserve(view.count());
+    auto *elementsPtr = view.data();
+    for (uint i = 0; i < view.count(); i++) this->append(elementsPtr[i]);
+  }
+
   void toString()
   {
     auto *traversalPtr = this->_headPtr;
@@ -196,6 +377,7 @@ public:
   }
 };
 
+#ifndef DSA_NO_MAIN
 int main()
 {
   SinglyLinkedList list;
@@ -215,5 +397,103 @@ int main()
   assert(list.atHead() == 99);
   assert(list.atTail() == 0);
 
+  auto poolPtr = std::make_shared<NodePool<Node>>();
+  SinglyLinkedList first(poolPtr);
+  SinglyLinkedList second(poolPtr);
+
+  for (int i = 0; i < 300; i++) first.append(i);
+  assert(poolPtr->slabs() == 2);
+  while (!first.empty()) first.removeHead();
+
+  for (int i = 0; i < 300; i++) second.prepend(i);
+  assert(poolPtr->slabs() == 2);
+  assert(poolPtr->nodes() == 300);
+  assert(second.atHead() == 299 && second.atTail() == 0);
+
+  second.clear();
+  assert(poolPtr->nodes() == 0);
+
+  list.clear();
+  assert(list.empty() == true);
+  list.append(1);
+  list.removeTail();
+  assert(list.empty() == true);
+
+  SinglyLinkedList source(poolPtr);
+  SinglyLinkedList target(poolPtr);
+
+  for (int i = 0; i < 6; i++) source.append(i);
+  target.append(100);
+  target.append(101);
+  target.splice(1, source, 2, 5);
+  assert(target.size() == 5 && source.size() == 3);
+  assert(target.at(0) == 100 && target.at(1) == 2 && target.at(3) == 4 && target.atTail() == 101);
+  assert(source.at(1) == 1 && source.atTail() == 5);
+  target.splice(target.size(), source, 2, 3);
+  assert(target.atTail() == 5 && source.atTail() == 1);
+  target.splice(0, source);
+  assert(source.empty() == true && target.atHead() == 0 && target.size() == 8);
+  assert(poolPtr->nodes() == 8);
+
+  target.sort();
+  int sorted[] = {0, 1, 2, 3, 4, 5, 100, 101};
+  for (uint i = 0; i < 8; i++) assert(target.at(i) == sorted[i]);
+
+  for (int i = 0; i < 10; i++) source.append(i * 20);
+  target.merge(source);
+  assert(target.size() == 18 && source.empty() == true);
+  for (uint i = 1; i < target.size(); i++) assert(target.at(i - 1) <= target.at(i));
+  assert(target.atHead() == 0 && target.atTail() == 180);
+  target.append(-1);
+  assert(target.atTail() == -1);
+
+  SinglyLinkedList large(poolPtr);
+  for (int i = 0; i < 1000; i++) large.append((i * 7919) % 1009);
+  auto nodes = poolPtr->nodes();
+  large.sort();
+  assert(poolPtr->nodes() == nodes);
+  for (uint i = 1; i < large.size(); i++) assert(large.at(i - 1) <= large.at(i));
+  large.removeTail();
+  large.append(5000);
+  assert(large.atTail() == 5000);
+
+  SinglyLinkedList separate;
+  bool threw = false;
+  try
+  {
+    separate.merge(large);
+  }
+  catch (const std::invalid_argument &)
+  {
+    threw = true;
+  }
+  assert(threw == true);
+
+  char pathTemplate[] = "/tmp/SinglyLinkedList.snapshot.XXXXXX";
+  auto fileDescriptor = mkstemp(pathTemplate);
+  assert(fileDescriptor != -1);
+  close(fileDescriptor);
+  const std::string path = pathTemplate;
+  SinglyLinkedList saved;
+  for (int i = 0; i < 1000; i++) saved.append(1000 - i);
+  saved.saveSnapshot(path);
+
+  auto snapshotPoolPtr = std::make_shared<NodePool<Node>>();
+  SinglyLinkedList restored(snapshotPoolPtr);
+  restored.append(-1);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 1000 && snapshotPoolPtr->slabs() == 2);
+  assert(restored.atHead() == 1000 && restored.atTail() == 1);
+  for (uint i = 0; i < restored.size(); i++) assert(restored.at(i) == 1000 - (int)i);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 1000 && restored.at(999) == 1 && snapshotPoolPtr->slabs() == 2);
+
+  SinglyLinkedList empty;
+  empty.saveSnapshot(path);
+  restored.loadSnapshot(path);
+  assert(restored.empty() == true);
+  unlink(path.c_str());
+
   return 0;
 }
+#endif
@@ -0,0 +1,415 @@
+/*
+  Data Structures | Treap List
+
+  This treap list will only cover `int` data types.
+
+  A sequence with the list API whose positional operations run in O(log n).
+  The elements are kept in an implicit treap: a binary tree whose in-order
+  traversal is the sequence, balanced by random heap priorities. Every
+  node stores the size of its subtree, so index i is found by descending
+  from the root and comparing i with the size of the left subtree. No keys
+  are stored; an element's index is its position in the traversal.
+
+  Everything is built from two operations, both O(log n) expected: `split`
+  cuts the sequence in two at an index, and `merge` joins two sequences
+  end to end. A batch of k elements is built into its own treap in O(k) and
+  joined in with one split and two merges, and a range of k elements is cut
+  out with two splits and one merge, so batch edits cost O(k + log n)
+  instead of k separate positional edits.
+
+  Nodes come from a `NodePool` (see `common/NodePool.hpp`).
+
+  `insertAt` keeps the contract of `DoublyLinkedList::insertAt`: the index
+  must be below `size()`, and inserting at the last index appends, so the
+  new element becomes the tail instead of landing before it.
+  `insertRangeAt` has no list counterpart and takes any index up to
+  `size()`, leaving the first inserted element at that index.
+
+  ---------  Time Complexities  ---------
+  | Append at head      | O(log n)      |
+  | Append at tail      | O(log n)      |
+  | Insert at index i   | O(log n)      |
+  | Insert k at index i | O(k + log n)  |
+  | Delete at head      | O(log n)      |
+  | Delete at tail      | O(log n)      |
+  | Delete at index i   | O(log n)      |
+  | Delete k at index i | O(k + log n)  |
+  | Search              | O(n)          |
+  | Access head         | O(log n)      |
+  | Access tail         | O(log n)      |
+  | Access index i      | O(log n)      |
+  ---------------------------------------
+*/
+
+#include <iostream>
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "../common/NodePool.hpp"
+
+class TreapNode
+{
+public:
+  int data;
+  unsigned int priority;
+  unsigned int size;
+  TreapNode *leftPtr;
+  TreapNode *rightPtr;
+
+  TreapNode(int data, unsigned int priority)
+  {
+    this->data = data;
+    this->priority = priority;
+    this->size = 1;
+    this->leftPtr = nullptr;
+    this->rightPtr = nullptr;
+  }
+};
+
+class TreapList
+{
+private:
+  typedef unsigned int uint;
+  TreapNode *_rootPtr;
+  uint _seed;
+  std::shared_ptr<NodePool<TreapNode>> _poolPtr;
+  bool _isIndexOutOfBounds(uint index) { return index >= this->size(); }
+
+  static uint _sizeOf(TreapNode *nodePtr) { return nodePtr == nullptr ? 0 : nodePtr->size; }
+
+  static void _update(TreapNode *nodePtr) { nodePtr->size = 1 + _sizeOf(nodePtr->leftPtr) + _sizeOf(nodePtr->rightPtr); }
+
+  // Xorshift32: the treap only needs priorities that are independent of the data.
+  uint _nextPriority()
+  {
+    this->_seed ^= this->_seed << 13;
+    this->_seed ^= this->_seed >> 17;
+    this->_seed ^= this->_seed << 5;
+    return this->_seed;
+  }
+
+  // Cuts the first `count` elements of `nodePtr` off into `leftPtr` and the rest into `rightPtr`.
+  static void _split(TreapNode *nodePtr, uint count, TreapNode *&leftPtr, TreapNode *&rightPtr)
+  {
+    if (nodePtr == nullptr)
+    {
+      leftPtr = nullptr;
+      rightPtr = nullptr;
+      return;
+    }
+    if (_sizeOf(nodePtr->leftPtr) < count)
+    {
+      _split(nodePtr->rightPtr, count - _sizeOf(nodePtr->leftPtr) - 1, nodePtr->rightPtr, rightPtr);
+      leftPtr = nodePtr;
+    }
+    else
+    {
+      _split(nodePtr->leftPtr, count, leftPtr, nodePtr->leftPtr);
+      rightPtr = nodePtr;
+    }
+    _update(nodePtr);
+  }
+
+  // Joins two treaps so that every element of `leftPtr` comes before every element of `rightPtr`.
+  static TreapNode *_merge(TreapNode *leftPtr, TreapNode *rightPtr)
+  {
+    if (leftPtr == nullptr) return rightPtr;
+    if (rightPtr == nullptr) return leftPtr;
+    if (leftPtr->priority > rightPtr->priority)
+    {
+      leftPtr->rightPtr = _merge(leftPtr->rightPtr, rightPtr);
+      _update(leftPtr);
+      return leftPtr;
+    }
+    rightPtr->leftPtr = _merge(leftPtr, rightPtr->leftPtr);
+    _update(rightPtr);
+    return rightPtr;
+  }
+
+  TreapNode *_nodeAt(uint index)
+  {
+    auto *traversalPtr = this->_rootPtr;
+    while (true)
+    {
+      auto leftSize = _sizeOf(traversalPtr->leftPtr);
+      if (index == leftSize) return traversalPtr;
+      if (index < leftSize) traversalPtr = traversalPtr->leftPtr;
+      else
+      {
+        index -= leftSize + 1;
+        traversalPtr = traversalPtr->rightPtr;
+      }
+    }
+  }
+
+  // Builds `count` elements into a perfectly balanced tree, then sifts the priorities into heap order.
+  template <typename InputIt>
+  TreapNode *_build(InputIt &first, uint count)
+  {
+    if (count == 0) return nullptr;
+    auto *leftPtr = this->_build(first, count / 2);
+    auto *nodePtr = this->_poolPtr->create(*first, this->_nextPriority());
+    ++first;
+    nodePtr->leftPtr = leftPtr;
+    nodePtr->rightPtr = this->_build(first, count - count / 2 - 1);
+    _update(nodePtr);
+    for (auto *siftPtr = nodePtr; true;)
+    {
+      auto *largestPtr = siftPtr;
+      if (siftPtr->leftPtr != nullptr && siftPtr->leftPtr->priority > largestPtr->priority) largestPtr = siftPtr->leftPtr;
+      if (siftPtr->rightPtr != nullptr && siftPtr->rightPtr->priority > largestPtr->priority) largestPtr = siftPtr->rightPtr;
+      if (largestPtr == siftPtr) break;
+      std::swap(siftPtr->priority, largestPtr->priority);
+      siftPtr = largestPtr;
+    }
+    return nodePtr;
+  }
+
+  void _destroy(TreapNode *nodePtr)
+  {
+    if (nodePtr == nullptr) return;
+    this->_destroy(nodePtr->leftPtr);
+    this->_destroy(nodePtr->rightPtr);
+    this->_poolPtr->destroy(nodePtr);
+  }
+
+  template <typename Visitor>
+  static void _visit(TreapNode *nodePtr, Visitor &visitor)
+  {
+    if (nodePtr == nullptr) return;
+    _visit(nodePtr->leftPtr, visitor);
+    visitor(nodePtr->data);
+    _visit(nodePtr->rightPtr, visitor);
+  }
+
+public:
+  uint size() { return _sizeOf(this->_rootPtr); }
+  bool empty() { return this->_rootPtr == nullptr; }
+
+  TreapList() : TreapList(std::make_shared<NodePool<TreapNode>>()) {}
+
+  TreapList(std::shared_ptr<NodePool<TreapNode>> poolPtr)
+  {
+    this->_rootPtr = nullptr;
+    this->_seed = 2463534242u;
+    this->_poolPtr = std::move(poolPtr);
+  }
+
+  TreapList(const TreapList &) = delete;
+  TreapList &operator=(const TreapList &) = delete;
+
+  ~TreapList() { this->clear(); }
+
+  void clear()
+  {
+    if (this->_poolPtr.use_count() == 1) this->_poolPtr->release();
+    else this->_destroy(this->_rootPtr);
+    this->_rootPtr = nullptr;
+  }
+
+  void append(int data) { this->_rootPtr = _merge(this->_rootPtr, this->_poolPtr->create(data, this->_nextPriority())); }
+
+  void prepend(int data) { this->_rootPtr = _merge(this->_poolPtr->create(data, this->_nextPriority()), this->_rootPtr); }
+
+  void insertAt(uint index, int data)
+  {
+    if (index >= this->size()) throw std::out_of_range("Index is out of bounds.");
+    else if (index == this->size() - 1) this->append(data);
+    else
+    {
+      TreapNode *leftPtr, *rightPtr;
+      _split(this->_rootPtr, index, leftPtr, rightPtr);
+      auto *newNodePtr = this->_poolPtr->create(data, this->_nextPriority());
+      this->_rootPtr = _merge(_merge(leftPtr, newNodePtr), rightPtr);
+    }
+  }
+
+  // Inserts [first, last) so that `*first` ends up at `index`.
+  template <typename InputIt>
+  void insertRangeAt(uint index, InputIt first, InputIt last)
+  {
+    if (index > this->size()) throw std::out_of_range("Index is out of bounds.");
+    auto count = (uint)std::distance(first, last);
+    if (count == 0) return;
+    auto *batchPtr = this->_build(first, count);
+    TreapNode *leftPtr, *rightPtr;
+    _split(this->_rootPtr, index, leftPtr, rightPtr);
+    this->_rootPtr = _merge(_merge(leftPtr, batchPtr), rightPtr);
+  }
+
+  void removeHead()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    this->removeAt(0);
+  }
+
+  void removeTail()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    this->removeAt(this->size() - 1);
+  }
+
+  void removeAt(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    TreapNode *leftPtr, *middlePtr, *rightPtr;
+    _split(this->_rootPtr, index, leftPtr, rightPtr);
+    _split(rightPtr, 1, middlePtr, rightPtr);
+    this->_poolPtr->destroy(middlePtr);
+    this->_rootPtr = _merge(leftPtr, rightPtr);
+  }
+
+  // Removes the elements at indices [first, last).
+  void removeRange(uint first, uint last)
+  {
+    if (first > last || last > this->size()) throw std::out_of_range("Index is out of bounds.");
+    TreapNode *leftPtr, *middlePtr, *rightPtr;
+    _split(this->_rootPtr, last, middlePtr, rightPtr);
+    _split(middlePtr, first, leftPtr, middlePtr);
+    this->_destroy(middlePtr);
+    this->_rootPtr = _merge(leftPtr, rightPtr);
+  }
+
+  int atHead()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    return this->_nodeAt(0)->data;
+  }
+
+  int atTail()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    return this->_nodeAt(this->size() - 1)->data;
+  }
+
+  int at(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    return this->_nodeAt(index)->data;
+  }
+
+  void set(uint index, int data)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    this->_nodeAt(index)->data = data;
+  }
+
+  bool contains(int data) { return this->indexOf(data) != -1; }
+
+  int indexOf(int data)
+  {
+    int index = -1;
+    int position = 0;
+    auto visitor = [&](int element) {
+      if (index == -1 && element == data) index = position;
+      position++;
+    };
+    _visit(this->_rootPtr, visitor);
+    return index;
+  }
+
+  void toString()
+  {
+    if (this->empty())
+    {
+      std::cout << "List is empty." << std::endl;
+      return;
+    }
+    auto visitor = [](int element) { std::cout << element << " <-> "; };
+    _visit(this->_rootPtr, visitor);
+    std::cout << "null" << std::endl;
+    std::cout << "Head: " << this->atHead() << std::endl;
+    std::cout << "Tail: " << this->atTail() << std::endl;
+    std::cout << "Size: " << this->size() << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+#include <vector>
+
+int main()
+{
+  TreapList list;
+
+  list.append(10);
+  list.append(11);
+  list.insertAt(list.size() - 1, 12);
+  list.prepend(9);
+  list.prepend(8);
+  list.insertAt(0, 7);
+  list.insertAt(1, 55);
+
+  assert(list.size() == 7);
+  assert(list.at(0) == 7);
+  assert(list.at(1) == 55);
+  assert(list.at(list.size() - 1) == 12);
+  assert(list.atHead() == 7);
+  assert(list.atTail() == 12);
+  assert(list.indexOf(10) == 4);
+  assert(list.contains(13) == false);
+
+  bool isOutOfBounds = false;
+  try
+  {
+    list.insertAt(list.size(), 13);
+  }
+  catch (const std::out_of_range &)
+  {
+    isOutOfBounds = true;
+  }
+  assert(isOutOfBounds == true && list.size() == 7);
+
+  list.toString();
+
+  list.removeHead();
+  list.removeAt(0);
+  list.removeAt(1);
+  list.removeTail();
+  list.set(0, 80);
+
+  assert(list.size() == 3);
+  assert(list.at(0) == 80 && list.at(1) == 10 && list.at(2) == 11);
+
+  list.toString();
+
+  int batch[] = {1, 2, 3, 4, 5};
+  list.insertRangeAt(1, batch, batch + 5);
+  assert(list.size() == 8);
+  assert(list.at(0) == 80 && list.at(1) == 1 && list.at(5) == 5 && list.at(6) == 10);
+  list.removeRange(2, 6);
+  assert(list.size() == 4);
+  assert(list.at(1) == 1 && list.at(2) == 10);
+
+  TreapList large;
+  std::vector<int> expected;
+
+  for (int i = 0; i < 20000; i++)
+  {
+    auto index = expected.empty() ? 0 : (uint)((i * 7919u) % expected.size());
+    if (expected.empty()) large.append(i);
+    else large.insertAt(index, i);
+    if (!expected.empty() && index == expected.size() - 1) index++;
+    expected.insert(expected.begin() + index, i);
+  }
+  std::vector<int> values(3000);
+  for (int i = 0; i < 3000; i++) values[i] = -i;
+  large.insertRangeAt(12345, values.begin(), values.end());
+  expected.insert(expected.begin() + 12345, values.begin(), values.end());
+  for (int i = 0; i < 15000; i++)
+  {
+    auto index = (uint)((i * 104729u) % expected.size());
+    large.removeAt(index);
+    expected.erase(expected.begin() + index);
+  }
+  large.removeRange(100, 2100);
+  expected.erase(expected.begin() + 100, expected.begin() + 2100);
+
+  assert(large.size() == expected.size());
+  for (uint i = 0; i < expected.size(); i++) assert(large.at(i) == expected[i]);
+
+  while (!large.empty()) large.removeHead();
+
+  return 0;
+}
+#endif
@@ -0,0 +1,405 @@
+/*
+  Data Structures | Unrolled Doubly-Linked List
+
+  This unrolled doubly-linked list will only cover `int` data types.
+
+  Each node holds a small array of up to `NodeCapacity` elements instead of a
+  single one, which amortizes the two link pointers over many elements. The
+  default capacity fills two 64-byte cache lines exactly, so a traversal
+  touches one cache miss per 27 elements instead of one per element.
+
+  A full node splits in half when an element is inserted into it. A node
+  that drops below half full merges with its successor when both fit in one
+  node. Together these keep nodes at least half full on average and never
+  empty. Positional operations first walk node by node from the nearer end,
+  skipping whole nodes by their counts, then shift within a single node.
+  Nodes come from a `NodePool` (see `common/NodePool.hpp`).
+
+  `insertAt` keeps the contract of `DoublyLinkedList::insertAt`: the index
+  must be below `size()`, and inserting at the last index appends, so the
+  new element becomes the tail instead of landing before it.
+
+  ------ Time Complexities  ------
+  | Append at head    | O(1)     |
+  | Append at tail    | O(1)     |
+  | Insert at index i | O(n / B) |
+  | Delete at head    | O(B)     |
+  | Delete at tail    | O(1)     |
+  | Delete at index i | O(n / B) |
+  | Search            | O(n)     |
+  | Access head       | O(1)     |
+  | Access tail       | O(1)     |
+  | Access index i    | O(n / B) |
+  --------------------------------
+  (B = NodeCapacity)
+*/
+
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include "../common/NodePool.hpp"
+
+template <unsigned int NodeCapacity>
+class alignas(64) UnrolledNode
+{
+public:
+  UnrolledNode *nextPtr;
+  UnrolledNode *previousPtr;
+  unsigned int count;
+  int data[NodeCapacity];
+
+  UnrolledNode()
+  {
+    this->nextPtr = nullptr;
+    this->previousPtr = nullptr;
+    this->count = 0;
+  }
+};
+
+template <unsigned int NodeCapacity = (128 - 2 * sizeof(void *) - sizeof(unsigned int)) / sizeof(int)>
+class UnrolledDoublyLinkedList
+{
+  static_assert(NodeCapacity >= 2, "Nodes must hold at least two elements to split.");
+
+private:
+  typedef unsigned int uint;
+  typedef UnrolledNode<NodeCapacity> Node;
+  Node *_headPtr;
+  Node *_tailPtr;
+  uint _size;
+  uint _nodes;
+  std::shared_ptr<NodePool<Node>> _poolPtr;
+  bool _isIndexOutOfBounds(uint index) { return index >= this->_size; }
+
+  // Finds the node holding `index` and turns `index` into an offset within it.
+  Node *_find(uint &index)
+  {
+    if (index < this->_size / 2)
+    {
+      auto *traversalPtr = this->_headPtr;
+      while (index >= traversalPtr->count)
+      {
+        index -= traversalPtr->count;
+        traversalPtr = traversalPtr->nextPtr;
+      }
+      return traversalPtr;
+    }
+    auto *traversalPtr = this->_tailPtr;
+    auto remaining = this->_size - index;
+    while (remaining > traversalPtr->count)
+    {
+      remaining -= traversalPtr->count;
+      traversalPtr = traversalPtr->previousPtr;
+    }
+    index = traversalPtr->count - remaining;
+    return traversalPtr;
+  }
+
+  Node *_createAfter(Node *nodePtr)
+  {
+    auto *newNodePtr = this->_poolPtr->create();
+    newNodePtr->previousPtr = nodePtr;
+    if (nodePtr == nullptr)
+    {
+      newNodePtr->nextPtr = this->_headPtr;
+      if (this->_headPtr != nullptr) this->_headPtr->previousPtr = newNodePtr;
+      this->_headPtr = newNodePtr;
+    }
+    else
+    {
+      newNodePtr->nextPtr = nodePtr->nextPtr;
+      if (nodePtr->nextPtr != nullptr) nodePtr->nextPtr->previousPtr = newNodePtr;
+      nodePtr->nextPtr = newNodePtr;
+    }
+    if (newNodePtr->nextPtr == nullptr) this->_tailPtr = newNodePtr;
+    this->_nodes++;
+    return newNodePtr;
+  }
+
+  void _unlink(Node *nodePtr)
+  {
+    if (nodePtr->previousPtr == nullptr) this->_headPtr = nodePtr->nextPtr;
+    else nodePtr->previousPtr->nextPtr = nodePtr->nextPtr;
+    if (nodePtr->nextPtr == nullptr) this->_tailPtr = nodePtr->previousPtr;
+    else nodePtr->nextPtr->previousPtr = nodePtr->previousPtr;
+    this->_poolPtr->destroy(nodePtr);
+    this->_nodes--;
+  }
+
+  // Moves the upper half of a full node into a new node after it.
+  void _split(Node *nodePtr)
+  {
+    auto *newNodePtr = this->_createAfter(nodePtr);
+    auto half = nodePtr->count / 2;
+    newNodePtr->count = nodePtr->count - half;
+    std::memcpy(newNodePtr->data, nodePtr->data + half, newNodePtr->count * sizeof(int));
+    nodePtr->count = half;
+  }
+
+  // Drops an empty node, or folds a sparse node's successor into it when both fit.
+  void _rebalance(Node *nodePtr)
+  {
+    if (nodePtr->count == 0)
+    {
+      this->_unlink(nodePtr);
+      return;
+    }
+    auto *nextNodePtr = nodePtr->nextPtr;
+    if (nodePtr->count >= NodeCapacity / 2 || nextNodePtr == nullptr) return;
+    if (nodePtr->count + nextNodePtr->count > NodeCapacity) return;
+    std::memcpy(nodePtr->data + nodePtr->count, nextNodePtr->data, nextNodePtr->count * sizeof(int));
+    nodePtr->count += nextNodePtr->count;
+    this->_unlink(nextNodePtr);
+  }
+
+  void _insertInto(Node *nodePtr, uint offset, int data)
+  {
+    if (nodePtr->count == NodeCapacity)
+    {
+      this->_split(nodePtr);
+      if (offset > nodePtr->count)
+      {
+        offset -= nodePtr->count;
+        nodePtr = nodePtr->nextPtr;
+      }
+    }
+    std::memmove(nodePtr->data + offset + 1, nodePtr->data + offset, (nodePtr->count - offset) * sizeof(int));
+    nodePtr->data[offset] = data;
+    nodePtr->count++;
+    this->_size++;
+  }
+
+  void _removeFrom(Node *nodePtr, uint offset)
+  {
+    std::memmove(nodePtr->data + offset, nodePtr->data + offset + 1, (nodePtr->count - offset - 1) * sizeof(int));
+    nodePtr->count--;
+    this->_size--;
+    this->_rebalance(nodePtr);
+  }
+
+public:
+  uint size() { return this->_size; }
+  uint nodes() { return this->_nodes; }
+  bool empty() { return this->_size == 0; }
+
+  UnrolledDoublyLinkedList() : UnrolledDoublyLinkedList(std::make_shared<NodePool<Node>>()) {}
+
+  UnrolledDoublyLinkedList(std::shared_ptr<NodePool<Node>> poolPtr)
+  {
+    this->_headPtr = nullptr;
+    this->_tailPtr = nullptr;
+    this->_size = 0;
+    this->_nodes = 0;
+    this->_poolPtr = std::move(poolPtr);
+  }
+
+  UnrolledDoublyLinkedList(const UnrolledDoublyLinkedList &) = delete;
+  UnrolledDoublyLinkedList &operator=(const UnrolledDoublyLinkedList &) = delete;
+
+  ~UnrolledDoublyLinkedList() { this->clear(); }
+
+  void clear()
+  {
+    if (this->_poolPtr.use_count() == 1) this->_poolPtr->release();
+    else
+    {
+      while (this->_headPtr != nullptr)
+      {
+        auto *nextNodePtr = this->_headPtr->nextPtr;
+        this->_poolPtr->destroy(this->_headPtr);
+        this->_headPtr = nextNodePtr;
+      }
+    }
+    this->_headPtr = nullptr;
+    this->_tailPtr = nullptr;
+    this->_size = 0;
+    this->_nodes = 0;
+  }
+
+  void append(int data)
+  {
+    if (this->empty() || this->_tailPtr->count == NodeCapacity) this->_createAfter(this->_tailPtr);
+    this->_tailPtr->data[this->_tailPtr->count++] = data;
+    this->_size++;
+  }
+
+  void prepend(int data)
+  {
+    if (this->empty()) this->_createAfter(nullptr);
+    this->_insertInto(this->_headPtr, 0, data);
+  }
+
+  void insertAt(uint index, int data)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    else if (index == this->_size - 1) this->append(data);
+    else
+    {
+      auto *nodePtr = this->_find(index);
+      this->_insertInto(nodePtr, index, data);
+    }
+  }
+
+  void removeHead()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    this->_removeFrom(this->_headPtr, 0);
+  }
+
+  void removeTail()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    this->_tailPtr->count--;
+    this->_size--;
+    if (this->_tailPtr->count == 0) this->_unlink(this->_tailPtr);
+  }
+
+  void removeAt(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    auto *nodePtr = this->_find(index);
+    this->_removeFrom(nodePtr, index);
+  }
+
+  int atHead()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    return this->_headPtr->data[0];
+  }
+
+  int atTail()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    return this->_tailPtr->data[this->_tailPtr->count - 1];
+  }
+
+  int at(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    auto *nodePtr = this->_find(index);
+    return nodePtr->data[index];
+  }
+
+  bool contains(int data) { return this->indexOf(data) != -1; }
+
+  int indexOf(int data)
+  {
+    uint base = 0;
+    for (auto *traversalPtr = this->_headPtr; traversalPtr != nullptr; traversalPtr = traversalPtr->nextPtr)
+    {
+      for (uint i = 0; i < traversalPtr->count; i++) if (traversalPtr->data[i] == data) return base + i;
+      base += traversalPtr->count;
+    }
+    return -1;
+  }
+
+  void toString()
+  {
+    if (this->empty())
+    {
+      std::cout << "List is empty." << std::endl;
+      return;
+    }
+    for (auto *traversalPtr = this->_headPtr; traversalPtr != nullptr; traversalPtr = traversalPtr->nextPtr)
+    {
+      std::cout << "[";
+      for (uint i = 0; i < traversalPtr->count; i++)
+      {
+        if (i == traversalPtr->count - 1) std::cout << traversalPtr->data[i];
+        else std::cout << traversalPtr->data[i] << ", ";
+      }
+      std::cout << "]";
+      if (traversalPtr->nextPtr != nullptr) std::cout << " <-> ";
+    }
+    std::cout << " -> null" << std::endl;
+    std::cout << "Head: " << this->atHead() << std::endl;
+    std::cout << "Tail: " << this->atTail() << std::endl;
+    std::cout << "Size: " << this->_size << std::endl;
+    std::cout << "Nodes: " << this->_nodes << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+int main()
+{
+  static_assert(sizeof(UnrolledNode<27>) == 128, "Default nodes span two cache lines.");
+
+  UnrolledDoublyLinkedList<4> list;
+
+  list.append(10);
+  list.append(11);
+  list.append(12);
+  list.prepend(9);
+  list.prepend(8);
+  list.insertAt(0, 7);
+  list.insertAt(1, 55);
+
+  assert(list.size() == 7);
+  assert(list.at(0) == 7);
+  assert(list.at(1) == 55);
+  assert(list.at(2) == 8);
+  assert(list.at(list.size() - 1) == 12);
+  assert(list.atHead() == 7);
+  assert(list.atTail() == 12);
+  assert(list.indexOf(10) == 4);
+
+  list.insertAt(list.size() - 1, 13);
+  assert(list.size() == 8 && list.at(6) == 12 && list.atTail() == 13);
+  bool isOutOfBounds = false;
+  try
+  {
+    list.insertAt(list.size(), 14);
+  }
+  catch (const std::out_of_range &)
+  {
+    isOutOfBounds = true;
+  }
+  assert(isOutOfBounds == true && list.size() == 8);
+  list.removeTail();
+
+  list.toString();
+
+  list.removeHead();
+  list.removeAt(0);
+  list.removeAt(1);
+  list.removeTail();
+
+  assert(list.size() == 3);
+  assert(list.at(0) == 8 && list.at(1) == 10 && list.at(2) == 11);
+
+  list.toString();
+
+  UnrolledDoublyLinkedList<> large;
+  int expected[2000];
+  uint expectedSize = 0;
+
+  for (int i = 0; i < 1000; i++)
+  {
+    auto index = expectedSize == 0 ? 0 : (i * 7919) % expectedSize;
+    if (expectedSize == 0) large.append(i);
+    else large.insertAt(index, i);
+    if (expectedSize != 0 && index == expectedSize - 1) index = expectedSize;
+    std::memmove(expected + index + 1, expected + index, (expectedSize - index) * sizeof(int));
+    expected[index] = i;
+    expectedSize++;
+  }
+  for (uint i = 0; i < expectedSize; i++) assert(large.at(i) == expected[i]);
+
+  for (int i = 0; i < 900; i++)
+  {
+    auto index = (i * 104729) % expectedSize;
+    large.removeAt(index);
+    std::memmove(expected + index, expected + index + 1, (expectedSize - index - 1) * sizeof(int));
+    expectedSize--;
+  }
+  assert(large.size() == expectedSize);
+  for (uint i = 0; i < expectedSize; i++) assert(large.at(i) == expected[i]);
+  assert(large.nodes() <= 2 * (expectedSize / 13 + 1));
+
+  while (!large.empty()) large.removeTail();
+  assert(large.nodes() == 0);
+
+  return 0;
+}
+#endif
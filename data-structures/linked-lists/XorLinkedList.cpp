@@ -0,0 +1,396 @@
+/*
+  Data Structures | XOR-Linked List
+
+  This XOR-linked list will only cover `int` data types.
+
+  A doubly-linked list whose nodes store one link instead of two: the XOR
+  of the previous and the next node's addresses. Walking in either
+  direction needs the address of the node just left behind, since
+  `next = link ^ previous` and `previous = link ^ next`. The head's link is
+  just its successor and the tail's just its predecessor, so traversal can
+  start from either end. A node takes 16 bytes instead of the 24 of a
+  `DoublyLinkedList` node.
+
+  The price is that a node address alone cannot be stepped from, so there
+  is no O(1) removal through a single node pointer, and every step does an
+  extra XOR. `Iterator` carries the node pair; `begin()` walks from head to
+  tail and `rbegin()` from tail to head.
+
+  Nodes come from a `NodePool` (see `common/NodePool.hpp`), which works as
+  for `DoublyLinkedList`.
+
+  `insertAt` keeps the contract of `DoublyLinkedList::insertAt`: the index
+  must be below `size()`, and inserting at the last index appends, so the
+  new element becomes the tail instead of landing before it.
+
+  ---- Time Complexities  ----
+  | Append at head    | O(1) |
+  | Append at tail    | O(1) |
+  | Insert at index i | O(n) |
+  | Delete at head    | O(1) |
+  | Delete at tail    | O(1) |
+  | Delete at index i | O(n) |
+  | Search            | O(n) |
+  | Access head       | O(1) |
+  | Access tail       | O(1) |
+  | Access index i    | O(n) |
+  ----------------------------
+*/
+
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include "../common/NodePool.hpp"
+
+class XorNode
+{
+public:
+  int data;
+  std::uintptr_t link;
+
+  XorNode(int data, std::uintptr_t link)
+  {
+    this->data = data;
+    this->link = link;
+  }
+};
+
+class XorLinkedList
+{
+private:
+  typedef unsigned int uint;
+  XorNode *_headPtr;
+  XorNode *_tailPtr;
+  uint _size;
+  std::shared_ptr<NodePool<XorNode>> _poolPtr;
+  bool _isIndexOutOfBounds(uint index) { return index >= this->_size; }
+
+  static std::uintptr_t _address(XorNode *nodePtr) { return reinterpret_cast<std::uintptr_t>(nodePtr); }
+
+  // Returns the neighbour of `nodePtr` on the other side from `fromPtr`.
+  static XorNode *_step(XorNode *fromPtr, XorNode *nodePtr)
+  {
+    return reinterpret_cast<XorNode *>(nodePtr->link ^ _address(fromPtr));
+  }
+
+  // Walks to `index` from the nearer end, returning the node there and its predecessor.
+  XorNode *_nodeAt(uint index, XorNode *&previousPtr)
+  {
+    XorNode *fromPtr = nullptr;
+    XorNode *traversalPtr;
+    if (index <= this->_size / 2)
+    {
+      traversalPtr = this->_headPtr;
+      for (uint i = 0; i < index; i++)
+      {
+        auto *nextPtr = _step(fromPtr, traversalPtr);
+        fromPtr = traversalPtr;
+        traversalPtr = nextPtr;
+      }
+      previousPtr = fromPtr;
+      return traversalPtr;
+    }
+    traversalPtr = this->_tailPtr;
+    for (uint i = this->_size - 1; i > index; i--)
+    {
+      auto *nextPtr = _step(fromPtr, traversalPtr);
+      fromPtr = traversalPtr;
+      traversalPtr = nextPtr;
+    }
+    previousPtr = _step(fromPtr, traversalPtr);
+    return traversalPtr;
+  }
+
+public:
+  // Walks the list in one direction. Two iterators are equal when they are on the same node.
+  class Iterator
+  {
+  private:
+    XorNode *_fromPtr;
+    XorNode *_nodePtr;
+
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef int value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef int *pointer;
+    typedef int &reference;
+
+    Iterator(XorNode *fromPtr, XorNode *nodePtr)
+    {
+      this->_fromPtr = fromPtr;
+      this->_nodePtr = nodePtr;
+    }
+
+    int &operator*() { return this->_nodePtr->data; }
+
+    Iterator &operator++()
+    {
+      auto *nextPtr = _step(this->_fromPtr, this->_nodePtr);
+      this->_fromPtr = this->_nodePtr;
+      this->_nodePtr = nextPtr;
+      return *this;
+    }
+
+    Iterator operator++(int)
+    {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(const Iterator &other) const { return this->_nodePtr == other._nodePtr; }
+    bool operator!=(const Iterator &other) const { return this->_nodePtr != other._nodePtr; }
+  };
+
+  uint size() { return this->_size; }
+  bool empty() { return this->_size == 0; }
+
+  XorLinkedList() : XorLinkedList(std::make_shared<NodePool<XorNode>>()) {}
+
+  XorLinkedList(std::shared_ptr<NodePool<XorNode>> poolPtr)
+  {
+    this->_headPtr = nullptr;
+    this->_tailPtr = nullptr;
+    this->_size = 0;
+    this->_poolPtr = std::move(poolPtr);
+  }
+
+  XorLinkedList(const XorLinkedList &) = delete;
+  XorLinkedList &operator=(const XorLinkedList &) = delete;
+
+  ~XorLinkedList() { this->clear(); }
+
+  Iterator begin() { return Iterator(nullptr, this->_headPtr); }
+  Iterator end() { return Iterator(nullptr, nullptr); }
+  Iterator rbegin() { return Iterator(nullptr, this->_tailPtr); }
+  Iterator rend() { return Iterator(nullptr, nullptr); }
+
+  void clear()
+  {
+    if (this->_poolPtr.use_count() == 1) this->_poolPtr->release();
+    else
+    {
+      XorNode *fromPtr = nullptr;
+      while (this->_headPtr != nullptr)
+      {
+        auto *nextPtr = _step(fromPtr, this->_headPtr);
+        this->_poolPtr->destroy(this->_headPtr);
+        fromPtr = this->_headPtr;
+        this->_headPtr = nextPtr;
+      }
+    }
+    this->_headPtr = nullptr;
+    this->_tailPtr = nullptr;
+    this->_size = 0;
+  }
+
+  void append(int data)
+  {
+    auto *newNodePtr = this->_poolPtr->create(data, _address(this->_tailPtr));
+    if (this->empty()) this->_headPtr = newNodePtr;
+    else this->_tailPtr->link ^= _address(newNodePtr);
+    this->_tailPtr = newNodePtr;
+    this->_size++;
+  }
+
+  void prepend(int data)
+  {
+    auto *newNodePtr = this->_poolPtr->create(data, _address(this->_headPtr));
+    if (this->empty()) this->_tailPtr = newNodePtr;
+    else this->_headPtr->link ^= _address(newNodePtr);
+    this->_headPtr = newNodePtr;
+    this->_size++;
+  }
+
+  // Inserts so that `data` ends up at `index`; `index` may equal size(), which appends.
+  void insertAt(uint index, int data)
+  {
+    if (index >= this->_size) throw std::out_of_range("Index is out of bounds.");
+    else if (index == 0) this->prepend(data);
+    else if (index == this->_size - 1) this->append(data);
+    else
+    {
+      XorNode *previousPtr;
+      auto *nextPtr = this->_nodeAt(index, previousPtr);
+      auto *newNodePtr = this->_poolPtr->create(data, _address(previousPtr) ^ _address(nextPtr));
+      previousPtr->link ^= _address(nextPtr) ^ _address(newNodePtr);
+      nextPtr->link ^= _address(previousPtr) ^ _address(newNodePtr);
+      this->_size++;
+    }
+  }
+
+  void removeHead()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    auto *tempNodePtr = this->_headPtr;
+    this->_headPtr = _step(nullptr, tempNodePtr);
+    if (this->_headPtr == nullptr) this->_tailPtr = nullptr;
+    else this->_headPtr->link ^= _address(tempNodePtr);
+    this->_poolPtr->destroy(tempNodePtr);
+    this->_size--;
+  }
+
+  void removeTail()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    auto *tempNodePtr = this->_tailPtr;
+    this->_tailPtr = _step(nullptr, tempNodePtr);
+    if (this->_tailPtr == nullptr) this->_headPtr = nullptr;
+    else this->_tailPtr->link ^= _address(tempNodePtr);
+    this->_poolPtr->destroy(tempNodePtr);
+    this->_size--;
+  }
+
+  void removeAt(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    else if (index == 0) this->removeHead();
+    else if (index == this->_size - 1) this->removeTail();
+    else
+    {
+      XorNode *previousPtr;
+      auto *nodePtr = this->_nodeAt(index, previousPtr);
+      auto *nextPtr = _step(previousPtr, nodePtr);
+      previousPtr->link ^= _address(nodePtr) ^ _address(nextPtr);
+      nextPtr->link ^= _address(nodePtr) ^ _address(previousPtr);
+      this->_poolPtr->destroy(nodePtr);
+      this->_size--;
+    }
+  }
+
+  int atHead()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    return this->_headPtr->data;
+  }
+
+  int atTail()
+  {
+    if (this->empty()) throw std::runtime_error("List is empty.");
+    return this->_tailPtr->data;
+  }
+
+  int at(uint index)
+  {
+    if (this->_isIndexOutOfBounds(index)) throw std::out_of_range("Index is out of bounds.");
+    XorNode *previousPtr;
+    return this->_nodeAt(index, previousPtr)->data;
+  }
+
+  bool contains(int data) { return this->indexOf(data) != -1; }
+
+  int indexOf(int data)
+  {
+    int index = 0;
+    for (auto element : *this)
+    {
+      if (element == data) return index;
+      index++;
+    }
+    return -1;
+  }
+
+  void toString()
+  {
+    if (this->empty())
+    {
+      std::cout << "List is empty." << std::endl;
+      return;
+    }
+    for (auto it = this->begin(); it != this->end(); ++it) std::cout << *it << " <-> ";
+    std::cout << "null" << std::endl;
+    std::cout << "Head: " << this->_headPtr->data << std::endl;
+    std::cout << "Tail: " << this->_tailPtr->data << std::endl;
+    std::cout << "Size: " << this->_size << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+#include <vector>
+
+int main()
+{
+  static_assert(sizeof(XorNode) == 16, "One link per node.");
+
+  XorLinkedList list;
+
+  list.append(10);
+  list.append(11);
+  list.insertAt(list.size() - 1, 12);
+  list.prepend(9);
+  list.prepend(8);
+  list.insertAt(0, 7);
+  list.insertAt(1, 55);
+
+  assert(list.at(0) == 7);
+  assert(list.at(1) == 55);
+  assert(list.at(5) == 11);
+  assert(list.at(list.size() - 1) == 12);
+  assert(list.atHead() == 7);
+  assert(list.atTail() == 12);
+  assert(list.indexOf(9) == 3);
+
+  bool isOutOfBounds = false;
+  try
+  {
+    list.insertAt(list.size(), 13);
+  }
+  catch (const std::out_of_range &)
+  {
+    isOutOfBounds = true;
+  }
+  assert(isOutOfBounds == true && list.size() == 7);
+
+  list.toString();
+
+  std::vector<int> backwards(list.rbegin(), list.rend());
+  int expectedBackwards[] = {12, 11, 10, 9, 8, 55, 7};
+  for (uint i = 0; i < 7; i++) assert(backwards[i] == expectedBackwards[i]);
+
+  list.removeHead();
+  list.removeAt(0);
+  list.removeAt(1);
+  list.removeAt(2);
+  list.removeTail();
+  list.toString();
+
+  assert(list.size() == 2);
+  assert(list.atHead() == 8 && list.atTail() == 10);
+
+  for (auto &element : list) element *= 2;
+  assert(list.at(0) == 16 && list.at(1) == 20);
+
+  XorLinkedList mixed;
+  std::vector<int> expected;
+  for (int i = 0; i < 2000; i++)
+  {
+    auto index = expected.empty() ? 0 : (uint)((i * 7919u) % expected.size());
+    if (i % 4 == 3 && !expected.empty())
+    {
+      mixed.removeAt(index);
+      expected.erase(expected.begin() + index);
+    }
+    else
+    {
+      if (expected.empty()) mixed.append(i);
+      else mixed.insertAt(index, i);
+      if (!expected.empty() && index == expected.size() - 1) index++;
+      expected.insert(expected.begin() + index, i);
+    }
+  }
+  assert(mixed.size() == expected.size());
+  uint position = 0;
+  for (auto element : mixed) assert(element == expected[position++]);
+  for (auto it = mixed.rbegin(); it != mixed.rend(); ++it) assert(*it == expected[--position]);
+
+  while (!mixed.empty()) mixed.removeTail();
+  mixed.append(1);
+  mixed.removeHead();
+  assert(mixed.empty() == true && mixed.begin() == mixed.end());
+
+  return 0;
+}
+#endif
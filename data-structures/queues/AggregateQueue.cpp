@@ -0,0 +1,259 @@
+/*
+  Data Structures | Aggregate Queue (Two Stacks)
+
+  This queue implementation will only cover `int` data types.
+
+  A FIFO queue that can also report the aggregate of everything in it
+  (the minimum, maximum, sum, ...) under any associative `Operator`, so a
+  sliding window over a stream is a `push` per event, a `pop` once the
+  window is full and a `query()`, none of which rescans the window.
+
+  The queue is two `StackDynamicArray`s. New elements are pushed onto the
+  back stack, and only the aggregate of the whole back stack is kept. The
+  front stack holds the oldest elements with the oldest on top, and next
+  to each of them the aggregate of it and everything newer in the front
+  stack. `query()` combines the top front aggregate with the back
+  aggregate. When a pop finds the front stack empty, the back stack is
+  moved over in one batch, computing the front aggregates on the way.
+  Every element is moved once, so pops are amortized O(1). The stacks use
+  `DoublingNoShrinkGrowth`: a window stays about the same size, and
+  shrinking would reallocate the front stack every time it drains.
+
+  `Operator` needs a `static int combine(int older, int newer)`; it must
+  be associative but need not be commutative or have an identity.
+  `MinAggregate`, `MaxAggregate` and `SumAggregate` are provided.
+
+  --- Time Complexities ---
+  | Push           | O(1) |
+  | Pop            | O(1) |
+  | Peek           | O(1) |
+  | Query          | O(1) |
+  -------------------------
+  (pop is amortized O(1))
+*/
+
+#ifndef DSA_NO_MAIN
+#define DSA_NO_MAIN
+#include "../stacks/StackDynamicArray.cpp"
+#undef DSA_NO_MAIN
+#else
+#include "../stacks/StackDynamicArray.cpp"
+#endif
+
+#include <algorithm>
+
+struct MinAggregate
+{
+  static int combine(int older, int newer) { return std::min(older, newer); }
+};
+
+struct MaxAggregate
+{
+  static int combine(int older, int newer) { return std::max(older, newer); }
+};
+
+struct SumAggregate
+{
+  static int combine(int older, int newer) { return older + newer; }
+};
+
+template <typename Operator = SumAggregate>
+class AggregateQueue
+{
+private:
+  typedef unsigned int uint;
+  StackDynamicArray<DoublingNoShrinkGrowth> _backValues;
+  StackDynamicArray<DoublingNoShrinkGrowth> _frontValues;
+  StackDynamicArray<DoublingNoShrinkGrowth> _frontAggregates;
+  int _backAggregate;
+  std::vector<int> _transfer;
+
+  // Moves the back stack onto the empty front stack, oldest element on top.
+  void _moveBackToFront()
+  {
+    auto count = this->_backValues.size();
+    this->_transfer.resize(count);
+    this->_backValues.popN(this->_transfer.data(), count);
+    std::reverse(this->_transfer.begin(), this->_transfer.end());
+    this->_frontValues.pushN(this->_transfer.data(), count);
+    for (uint i = 1; i < count; i++) this->_transfer[i] = Operator::combine(this->_transfer[i], this->_transfer[i - 1]);
+    this->_frontAggregates.pushN(this->_transfer.data(), count);
+  }
+
+public:
+  uint size() { return this->_backValues.size() + this->_frontValues.size(); }
+  bool empty() { return this->size() == 0; }
+
+  AggregateQueue() { this->_backAggregate = 0; }
+
+  AggregateQueue(const AggregateQueue &) = delete;
+  AggregateQueue &operator=(const AggregateQueue &) = delete;
+
+  void push(int element)
+  {
+    if (this->_backValues.empty()) this->_backAggregate = element;
+    else this->_backAggregate = Operator::combine(this->_backAggregate, element);
+    this->_backValues.push(element);
+  }
+
+  int pop()
+  {
+    if (this->empty()) throw std::runtime_error("Queue is empty.");
+    if (this->_frontValues.empty()) this->_moveBackToFront();
+    this->_frontAggregates.pop();
+    return this->_frontValues.pop();
+  }
+
+  // The oldest element.
+  int front()
+  {
+    if (this->empty()) throw std::runtime_error("Queue is empty.");
+    if (this->_frontValues.empty()) this->_moveBackToFront();
+    return this->_frontValues.top();
+  }
+
+  // The aggregate of every element from the oldest to the newest.
+  int query()
+  {
+    if (this->empty()) throw std::runtime_error("Queue is empty.");
+    if (this->_frontValues.empty()) return this->_backAggregate;
+    if (this->_backValues.empty()) return this->_frontAggregates.top();
+    return Operator::combine(this->_frontAggregates.top(), this->_backAggregate);
+  }
+
+  void toString()
+  {
+    if (this->empty())
+    {
+      std::cout << "Queue is empty." << std::endl;
+      return;
+    }
+    auto count = this->size();
+    std::vector<int> elements(count);
+    auto frontCount = this->_frontValues.size();
+    if (frontCount > 0)
+    {
+      this->_frontValues.popN(elements.data(), frontCount);
+      this->_frontValues.pushN(elements.data(), frontCount);
+      std::reverse(elements.begin(), elements.begin() + frontCount);
+    }
+    if (count > frontCount)
+    {
+      this->_backValues.popN(elements.data() + frontCount, count - frontCount);
+      this->_backValues.pushN(elements.data() + frontCount, count - frontCount);
+    }
+    for (uint i = 0; i < count; i++)
+    {
+      if (i == count - 1) std::cout << elements[i];
+      else std::cout << elements[i] << " <- ";
+    }
+    std::cout << std::endl;
+    std::cout << "Front: " << elements[0] << std::endl;
+    std::cout << "Aggregate: " << this->query() << std::endl;
+    std::cout << "Size: " << count << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+struct OldestAggregate
+{
+  static int combine(int older, int) { return older; }
+};
+
+struct NewestAggregate
+{
+  static int combine(int, int newer) { return newer; }
+};
+
+int main()
+{
+  AggregateQueue<MinAggregate> queue;
+
+  queue.push(5);
+  queue.push(3);
+  queue.push(8);
+
+  assert(queue.size() == 3);
+  assert(queue.query() == 3);
+  assert(queue.front() == 5);
+
+  queue.toString();
+
+  assert(queue.pop() == 5);
+  queue.push(1);
+  assert(queue.query() == 1);
+  assert(queue.pop() == 3);
+  assert(queue.pop() == 8);
+  assert(queue.query() == 1);
+  queue.push(4);
+  assert(queue.query() == 1);
+  assert(queue.pop() == 1);
+  assert(queue.query() == 4);
+  assert(queue.pop() == 4);
+  assert(queue.empty() == true);
+
+  bool isEmpty = false;
+  try
+  {
+    queue.query();
+  }
+  catch (const std::runtime_error &)
+  {
+    isEmpty = true;
+  }
+  assert(isEmpty == true);
+
+  // The operator sees the elements oldest first, whichever stacks they are split across.
+  AggregateQueue<OldestAggregate> oldest;
+  AggregateQueue<NewestAggregate> newest;
+  for (int i = 0; i < 100; i++)
+  {
+    oldest.push(i);
+    newest.push(i);
+    if (i % 3 == 2)
+    {
+      oldest.pop();
+      newest.pop();
+    }
+    assert(oldest.query() == oldest.front());
+    assert(newest.query() == i);
+  }
+
+  // Sliding windows against a rescan of the window.
+  const uint window = 37;
+  AggregateQueue<MinAggregate> minimum;
+  AggregateQueue<MaxAggregate> maximum;
+  AggregateQueue<SumAggregate> sum;
+  std::vector<int> stream;
+  uint seed = 12345;
+  for (uint i = 0; i < 5000; i++)
+  {
+    seed = seed * 1103515245 + 12345;
+    auto element = (int)((seed >> 8) % 2001) - 1000;
+    stream.push_back(element);
+    minimum.push(element);
+    maximum.push(element);
+    sum.push(element);
+    if (minimum.size() > window)
+    {
+      minimum.pop();
+      maximum.pop();
+      sum.pop();
+    }
+    auto first = stream.size() > window ? stream.size() - window : 0;
+    int expectedMinimum = stream[first], expectedMaximum = stream[first], expectedSum = 0;
+    for (auto j = first; j < stream.size(); j++)
+    {
+      expectedMinimum = std::min(expectedMinimum, stream[j]);
+      expectedMaximum = std::max(expectedMaximum, stream[j]);
+      expectedSum += stream[j];
+    }
+    assert(minimum.query() == expectedMinimum);
+    assert(maximum.query() == expectedMaximum);
+    assert(sum.query() == expectedSum);
+    assert(minimum.front() == stream[first]);
+  }
+
+  return 0;
+}
+#endif
@@ -0,0 +1,465 @@
+/*
+  Data Structures | Work-Stealing Deque (Chase-Lev)
+
+  A deque with one owner thread, which pushes and pops at the bottom like
+  a stack, and any number of thieves, which `steal` from the top without a
+  lock (the Chase-Lev deque). The owner's push and pop touch only the
+  bottom index and need no compare-and-swap. The two ends meet only when
+  one element is left, and then the owner and the thieves race for it
+  with one compare-and-swap on the top index. A thief that loses the race
+  gets false back and moves on to another victim.
+
+  The elements live in a circular buffer indexed by 64-bit positions that
+  only ever grow, so a position never wraps. When the buffer is full the
+  owner copies the live range into one twice the size. A thief may still
+  be reading the old buffer, so old buffers are kept until the deque is
+  destroyed. Together they are never larger than the live buffer.
+
+  `T` must be trivially copyable; a scheduler stores task pointers.
+
+  `WorkStealingPool` is a fork-join scheduler built on one deque per
+  thread. A `TaskGroup` spawns tasks onto the current thread's deque, and
+  `wait()` runs tasks, its own newest first and then stolen ones oldest
+  first, until every task of the group is done. A worker with nothing to
+  do steals from a random victim, so an idle thread takes the oldest, and
+  usually largest, piece of a busy thread's work.
+
+  ---- Time Complexities  ----
+  | Push              | O(1) |
+  | Pop               | O(1) |
+  | Steal             | O(1) |
+  ----------------------------
+  (push is amortized O(1) while the buffer grows)
+*/
+
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+class WorkStealingDeque
+{
+  static_assert(std::is_trivially_copyable<T>::value, "Elements must be trivially copyable.");
+
+private:
+  typedef unsigned int uint;
+  typedef long long Position;
+
+  struct Buffer
+  {
+    Position mask;
+    std::unique_ptr<std::atomic<T>[]> elements;
+
+    Buffer(Position capacity)
+    {
+      this->mask = capacity - 1;
+      this->elements.reset(new std::atomic<T>[capacity]);
+    }
+
+    Position capacity() { return this->mask + 1; }
+    T get(Position position) { return this->elements[position & this->mask].load(std::memory_order_relaxed); }
+    void put(Position position, T element) { this->elements[position & this->mask].store(element, std::memory_order_relaxed); }
+  };
+
+  alignas(64) std::atomic<Position> _top;
+  alignas(64) std::atomic<Position> _bottom;
+  std::atomic<Buffer *> _bufferPtr;
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+
+  // Only the owner calls this; the old buffer stays alive for thieves still reading it.
+  Buffer *_grow(Buffer *bufferPtr, Position top, Position bottom)
+  {
+    auto *grownPtr = new Buffer(bufferPtr->capacity() * 2);
+    for (auto position = top; position < bottom; position++) grownPtr->put(position, bufferPtr->get(position));
+    this->_buffers.emplace_back(grownPtr);
+    this->_bufferPtr.store(grownPtr, std::memory_order_release);
+    return grownPtr;
+  }
+
+public:
+  // Racy when called by anyone but the owner; a hint for thieves.
+  uint size()
+  {
+    auto bottom = this->_bottom.load(std::memory_order_relaxed);
+    auto top = this->_top.load(std::memory_order_relaxed);
+    return bottom > top ? (uint)(bottom - top) : 0;
+  }
+
+  bool empty() { return this->size() == 0; }
+  uint capacity() { return (uint)this->_bufferPtr.load(std::memory_order_relaxed)->capacity(); }
+
+  // `capacity` is rounded up to a power of two.
+  WorkStealingDeque(uint capacity = 64)
+  {
+    Position rounded = 1;
+    while (rounded < capacity) rounded *= 2;
+    this->_buffers.emplace_back(new Buffer(rounded));
+    this->_bufferPtr.store(this->_buffers.back().get(), std::memory_order_relaxed);
+    this->_top.store(0, std::memory_order_relaxed);
+    this->_bottom.store(0, std::memory_order_relaxed);
+  }
+
+  WorkStealingDeque(const WorkStealingDeque &) = delete;
+  WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+  // Owner only.
+  void push(T element)
+  {
+    auto bottom = this->_bottom.load(std::memory_order_relaxed);
+    auto top = this->_top.load(std::memory_order_acquire);
+    auto *bufferPtr = this->_bufferPtr.load(std::memory_order_relaxed);
+    if (bottom - top >= bufferPtr->capacity()) bufferPtr = this->_grow(bufferPtr, top, bottom);
+    bufferPtr->put(bottom, element);
+    this->_bottom.store(bottom + 1, std::memory_order_release);
+  }
+
+  // Owner only. Pops the newest element into `element`, or returns false if the deque was empty.
+  bool pop(T &element)
+  {
+    auto bottom = this->_bottom.load(std::memory_order_relaxed) - 1;
+    auto *bufferPtr = this->_bufferPtr.load(std::memory_order_relaxed);
+    // The claim on `bottom` must be visible before `top` is read, or a thief could take the same element.
+    this->_bottom.store(bottom, std::memory_order_seq_cst);
+    auto top = this->_top.load(std::memory_order_seq_cst);
+    if (top > bottom)
+    {
+      this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    element = bufferPtr->get(bottom);
+    if (top < bottom) return true;
+    auto isWon = this->_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    this->_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return isWon;
+  }
+
+  // Any thread. Steals the oldest element into `element`, or returns false if the deque was empty or
+  // another thread took that element first.
+  bool steal(T &element)
+  {
+    auto top = this->_top.load(std::memory_order_seq_cst);
+    auto bottom = this->_bottom.load(std::memory_order_seq_cst);
+    if (top >= bottom) return false;
+    element = this->_bufferPtr.load(std::memory_order_acquire)->get(top);
+    return this->_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+  }
+
+  // Only meaningful while no other thread is using the deque.
+  void toString()
+  {
+    auto top = this->_top.load(std::memory_order_relaxed);
+    auto bottom = this->_bottom.load(std::memory_order_relaxed);
+    if (top >= bottom)
+    {
+      std::cout << "Deque is empty." << std::endl;
+      return;
+    }
+    auto *bufferPtr = this->_bufferPtr.load(std::memory_order_relaxed);
+    for (auto position = top; position < bottom; position++)
+    {
+      if (position == bottom - 1) std::cout << bufferPtr->get(position);
+      else std::cout << bufferPtr->get(position) << " <- ";
+    }
+    std::cout << std::endl;
+    std::cout << "Top: " << bufferPtr->get(top) << std::endl;
+    std::cout << "Bottom: " << bufferPtr->get(bottom - 1) << std::endl;
+    std::cout << "Size: " << bottom - top << std::endl;
+    std::cout << "Capacity: " << bufferPtr->capacity() << std::endl;
+  }
+};
+
+class WorkStealingPool
+{
+public:
+  class TaskGroup;
+
+private:
+  typedef unsigned int uint;
+
+  struct Task
+  {
+    std::function<void()> function;
+    TaskGroup *groupPtr;
+  };
+
+  struct alignas(64) Worker
+  {
+    WorkStealingDeque<Task *> deque;
+  };
+
+  // The pool and worker the calling thread belongs to, if any.
+  struct Current
+  {
+    WorkStealingPool *poolPtr;
+    uint index;
+  };
+
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::vector<std::thread> _threads;
+  std::mutex _mutex;
+  std::condition_variable _runStarted;
+  std::atomic<uint> _activeRuns;
+  std::atomic<bool> _isStopping;
+
+  static Current &_current()
+  {
+    thread_local Current current = {nullptr, 0};
+    return current;
+  }
+
+  static uint _randomVictim(uint workers)
+  {
+    thread_local uint seed = (uint)std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed % workers;
+  }
+
+  // Runs one task from the calling worker's deque, or one stolen from another worker. Returns false if
+  // it found none.
+  bool _runOne()
+  {
+    auto index = _current().index;
+    Task *taskPtr = nullptr;
+    if (!this->_workers[index]->deque.pop(taskPtr))
+    {
+      auto workers = (uint)this->_workers.size();
+      auto start = _randomVictim(workers);
+      for (uint i = 0; i < workers && taskPtr == nullptr; i++)
+      {
+        auto victim = (start + i) % workers;
+        if (victim == index || !this->_workers[victim]->deque.steal(taskPtr)) taskPtr = nullptr;
+      }
+      if (taskPtr == nullptr) return false;
+    }
+    taskPtr->function();
+    taskPtr->groupPtr->_pending.fetch_sub(1, std::memory_order_release);
+    delete taskPtr;
+    return true;
+  }
+
+  void _work(uint index)
+  {
+    _current() = {this, index};
+    while (true)
+    {
+      if (this->_runOne()) continue;
+      if (this->_isStopping.load(std::memory_order_acquire)) return;
+      if (this->_activeRuns.load(std::memory_order_acquire) > 0)
+      {
+        std::this_thread::yield();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(this->_mutex);
+      this->_runStarted.wait(lock, [this] {
+        return this->_isStopping.load(std::memory_order_relaxed) || this->_activeRuns.load(std::memory_order_relaxed) > 0;
+      });
+    }
+  }
+
+  template <typename Function>
+  void _spawn(TaskGroup &group, Function function)
+  {
+    auto &current = _current();
+    if (current.poolPtr != this) throw std::logic_error("Tasks must be spawned from inside run().");
+    auto *taskPtr = new Task{std::function<void()>(std::move(function)), &group};
+    group._pending.fetch_add(1, std::memory_order_relaxed);
+    this->_workers[current.index]->deque.push(taskPtr);
+  }
+
+public:
+  // Tasks spawned into the group run on any thread of the pool. Tasks must not throw.
+  class TaskGroup
+  {
+  private:
+    friend class WorkStealingPool;
+    WorkStealingPool &_pool;
+    std::atomic<uint> _pending;
+
+  public:
+    TaskGroup(WorkStealingPool &pool) : _pool(pool) { this->_pending.store(0, std::memory_order_relaxed); }
+
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    ~TaskGroup() { this->wait(); }
+
+    template <typename Function>
+    void spawn(Function function)
+    {
+      this->_pool._spawn(*this, std::move(function));
+    }
+
+    // Runs tasks until every task spawned into this group has finished.
+    void wait()
+    {
+      while (this->_pending.load(std::memory_order_acquire) > 0)
+        if (!this->_pool._runOne()) std::this_thread::yield();
+    }
+  };
+
+  // `threads` counts the thread that calls `run`.
+  WorkStealingPool(uint threads = std::thread::hardware_concurrency())
+  {
+    if (threads == 0) threads = 1;
+    this->_activeRuns.store(0, std::memory_order_relaxed);
+    this->_isStopping.store(false, std::memory_order_relaxed);
+    for (uint i = 0; i < threads; i++) this->_workers.emplace_back(new Worker());
+    for (uint i = 1; i < threads; i++) this->_threads.emplace_back([this, i] { this->_work(i); });
+  }
+
+  WorkStealingPool(const WorkStealingPool &) = delete;
+  WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+  ~WorkStealingPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_isStopping.store(true, std::memory_order_release);
+    }
+    this->_runStarted.notify_all();
+    for (auto &thread : this->_threads) thread.join();
+  }
+
+  uint threads() { return (uint)this->_workers.size(); }
+
+  // Calls `root` on the calling thread, which works as worker 0 until `root` returns. Only one thread
+  // may be inside `run` at a time, and `root` must wait for the groups it spawns into.
+  template <typename Function>
+  void run(Function root)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_activeRuns.fetch_add(1, std::memory_order_release);
+    }
+    this->_runStarted.notify_all();
+    auto previous = _current();
+    _current() = {this, 0};
+    root();
+    _current() = previous;
+    this->_activeRuns.fetch_sub(1, std::memory_order_release);
+  }
+};
+
+#ifndef DSA_NO_MAIN
+#include <algorithm>
+
+long long fib(WorkStealingPool &pool, int n)
+{
+  if (n < 12) return n < 2 ? n : fib(pool, n - 1) + fib(pool, n - 2);
+  long long left = 0;
+  WorkStealingPool::TaskGroup group(pool);
+  group.spawn([&] { left = fib(pool, n - 1); });
+  auto right = fib(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+int main()
+{
+  WorkStealingDeque<int> deque(2);
+
+  deque.push(1);
+  deque.push(2);
+  deque.push(3);
+
+  assert(deque.size() == 3);
+  assert(deque.capacity() == 4);
+
+  deque.toString();
+
+  int element;
+  assert(deque.pop(element) == true && element == 3);
+  assert(deque.steal(element) == true && element == 1);
+  assert(deque.pop(element) == true && element == 2);
+  assert(deque.pop(element) == false);
+  assert(deque.steal(element) == false);
+  assert(deque.empty() == true);
+
+  for (int i = 0; i < 1000; i++) deque.push(i);
+  assert(deque.capacity() == 1024);
+  for (int i = 0; i < 500; i++) assert(deque.steal(element) == true && element == i);
+  for (int i = 999; i >= 500; i--) assert(deque.pop(element) == true && element == i);
+  assert(deque.empty() == true);
+
+  // The owner pushes and pops while thieves steal; every element must be taken exactly once.
+  {
+    const int thieves = 3;
+    const int elements = 200000;
+    WorkStealingDeque<int> shared;
+    std::vector<std::vector<int>> taken(thieves + 1);
+    std::atomic<bool> isDone(false);
+    std::vector<std::thread> threads;
+    for (int t = 1; t <= thieves; t++)
+    {
+      threads.emplace_back([&, t] {
+        int value;
+        while (!isDone.load(std::memory_order_acquire))
+          if (shared.steal(value)) taken[t].push_back(value);
+        while (shared.steal(value)) taken[t].push_back(value);
+      });
+    }
+    int value;
+    for (int i = 0; i < elements; i++)
+    {
+      shared.push(i);
+      if (i % 3 == 0 && shared.pop(value)) taken[0].push_back(value);
+    }
+    while (shared.pop(value)) taken[0].push_back(value);
+    isDone.store(true, std::memory_order_release);
+    for (auto &thread : threads) thread.join();
+
+    std::vector<bool> seen(elements, false);
+    for (auto &values : taken)
+    {
+      for (auto v : values)
+      {
+        assert(seen[v] == false);
+        seen[v] = true;
+      }
+    }
+    for (auto wasSeen : seen) assert(wasSeen == true);
+  }
+
+  WorkStealingPool pool(4);
+  assert(pool.threads() == 4);
+
+  long long result = 0;
+  pool.run([&] { result = fib(pool, 25); });
+  assert(result == 75025);
+
+  std::vector<int> values(100000);
+  for (uint i = 0; i < values.size(); i++) values[i] = (int)((i * 2654435761u) >> 8);
+  pool.run([&] {
+    WorkStealingPool::TaskGroup group(pool);
+    const uint chunk = 10000;
+    for (uint begin = 0; begin < values.size(); begin += chunk)
+      group.spawn([&values, begin, chunk] { std::sort(values.begin() + begin, values.begin() + begin + chunk); });
+    group.wait();
+  });
+  for (uint begin = 0; begin < values.size(); begin += 10000)
+    assert(std::is_sorted(values.begin() + begin, values.begin() + begin + 10000));
+
+  bool isOutside = false;
+  try
+  {
+    WorkStealingPool::TaskGroup group(pool);
+    group.spawn([] {});
+  }
+  catch (const std::logic_error &)
+  {
+    isOutside = true;
+  }
+  assert(isOutside == true);
+
+  return 0;
+}
+#endif
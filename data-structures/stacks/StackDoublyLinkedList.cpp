@@ -6,13 +6,30 @@
   --- Time Complexities ---
   | Push           | O(1) |
   | Pop            | O(1) |
+  | Push k         | O(k) |
+  | Pop k          | O(k) |
   | Peek           | O(1) |
   | Search         | O(n) |
   -------------------------
+
+  `pushN` builds its nodes into a chain and links the chain onto the top
+  in one step. `popN` reads and frees its nodes from the top down and
+  cuts the chain once below the last of them. It fills the output from
+  the back, so the popped elements come out in the order they were pushed
+  and the former top ends up last. A batch larger than the stack throws
+  before anything is popped.
+
+  Nodes come from a `NodePool` (see `common/NodePool.hpp`) that the stack
+  owns, so they are freed in bulk when the stack is cleared or destroyed.
+  `saveSnapshot` writes the elements bottom first (see
+  `common/Snapshot.hpp`), and `loadSnapshot` rebuilds the stack from the
+  mapped file with one pool allocation and one `pushN`.
 */
 
 #include <iostream>
 #include <cassert>
+#include "../common/NodePool.hpp"
+#include "../common/Snapshot.hpp"
 
 class Node
 {
@@ -43,6 +60,7 @@ private:
   Node *_headPtr;
   Node *_tailPtr;
   uint _size;
+  NodePool<Node> _pool;
 
 public:
   uint size() { return this->_size; }
@@ -55,9 +73,17 @@ public:
     this->_size = 0;
   }
 
+  void clear()
+  {
+    this->_pool.release();
+    this->_headPtr = nullptr;
+    this->_tailPtr = nullptr;
+    this->_size = 0;
+  }
+
   void push(int data)
   {
-    auto *newNodePtr = new Node(data);
+    auto *newNodePtr = this->_pool.create(data);
     if (this->empty())
     {
       this->_headPtr = newNodePtr;
@@ -87,11 +113,66 @@ public:
       this->_tailPtr = this->_tailPtr->previousPtr;
       this->_tailPtr->nextPtr = nullptr;
     }
-    delete tempNodePtr;
+    this->_pool.destroy(tempNodePtr);
     this->_size--;
     return data;
   }
 
+  void pushN(const int *elements, uint count)
+  {
+    if (count == 0) return;
+    auto *firstPtr = this->_pool.create(elements[0]);
+    auto *lastPtr = firstPtr;
+    for (uint i = 1; i < count; i++)
+    {
+      lastPtr->nextPtr = this->_pool.create(elements[i], nullptr, lastPtr);
+      lastPtr = lastPtr->nextPtr;
+    }
+    if (this->empty()) this->_headPtr = firstPtr;
+    else
+    {
+      this->_tailPtr->nextPtr = firstPtr;
+      firstPtr->previousPtr = this->_tailPtr;
+    }
+    this->_tailPtr = lastPtr;
+    this->_size += count;
+  }
+
+  // Pops the top `count` elements into `elements`, bottom-most first.
+  void popN(int *elements, uint count)
+  {
+    if (count > this->_size) throw std::runtime_error("Stack has too few elements.");
+    if (count == 0) return;
+    auto *traversalPtr = this->_tailPtr;
+    for (uint i = count; i > 0; i--)
+    {
+      auto *tempNodePtr = traversalPtr;
+      elements[i - 1] = traversalPtr->data;
+      traversalPtr = traversalPtr->previousPtr;
+      this->_pool.destroy(tempNodePtr);
+    }
+    this->_tailPtr = traversalPtr;
+    if (this->_tailPtr == nullptr) this->_headPtr = nullptr;
+    else this->_tailPtr->nextPtr = nullptr;
+    this->_size -= count;
+  }
+
+  void saveSnapshot(const std::string &path)
+  {
+    snapshot::Writer<int> writer(path, this->_size, this->_size);
+    for (auto *traversalPtr = this->_headPtr; traversalPtr != nullptr; traversalPtr = traversalPtr->nextPtr)
+      writer.append(traversalPtr->data);
+    writer.finish();
+  }
+
+  void loadSnapshot(const std::string &path)
+  {
+    snapshot::View<int> view(path);
+    this->clear();
+    this->_pool.reserve(view.count());
+    this->pushN(view.data(), view.count());
+  }
+
   int top()
   {
     if (this->empty()) throw std::runtime_error("Stack is empty.");
@@ -143,6 +224,7 @@ public:
   }
 };
 
+#ifndef DSA_NO_MAIN
 int main()
 {
   StackDoublyLinkedList stack;
@@ -175,5 +257,51 @@ int main()
 
   stack.toString();
 
+  int batch[] = {5, 6, 7, 8};
+  stack.pushN(batch, 4);
+  assert(stack.size() == 6 && stack.top() == 8);
+  assert(stack.indexOf(5) == 2);
+
+  int popped[6];
+  stack.popN(popped, 3);
+  assert(popped[0] == 6 && popped[1] == 7 && popped[2] == 8);
+  assert(stack.top() == 5 && stack.size() == 3);
+  stack.pop();
+
+  bool isShort = false;
+  try
+  {
+    stack.popN(popped, 3);
+  }
+  catch (const std::runtime_error &)
+  {
+    isShort = true;
+  }
+  assert(isShort == true && stack.size() == 2);
+
+  stack.popN(popped, 2);
+  assert(popped[0] == 1 && popped[1] == 2 && stack.empty() == true);
+  stack.pushN(batch, 2);
+  assert(stack.pop() == 6 && stack.pop() == 5 && stack.empty() == true);
+
+  char pathTemplate[] = "/tmp/StackDoublyLinkedList.snapshot.XXXXXX";
+  auto fileDescriptor = mkstemp(pathTemplate);
+  assert(fileDescriptor != -1);
+  close(fileDescriptor);
+  const std::string path = pathTemplate;
+  for (int i = 0; i < 1000; i++) stack.push(i);
+  stack.saveSnapshot(path);
+
+  StackDoublyLinkedList restored;
+  restored.push(-1);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 1000 && restored.top() == 999 && restored.indexOf(0) == 0);
+  for (int i = 999; i >= 0; i--) assert(restored.pop() == i);
+
+  restored.clear();
+  assert(restored.empty() == true);
+  unlink(path.c_str());
+
   return 0;
 }
+#endif
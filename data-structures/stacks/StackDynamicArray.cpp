@@ -3,17 +3,50 @@
 
   This stack implementation will only cover `int` data types.
 
+  How the capacity grows and shrinks is chosen by the `Policy` template
+  parameter (see `common/GrowthPolicy.hpp`). The default doubles when full and
+  halves once the stack is a quarter full, so alternating push/pop around a
+  capacity boundary does not reallocate on every call.
+
+  Where the buffer comes from is chosen by the `Allocation` template
+  parameter (see `common/Allocation.hpp`).
+
   --- Time Complexities ---
   | Push           | O(1) |
   | Pop            | O(1) |
+  | Push k         | O(k) |
+  | Pop k          | O(k) |
   | Peek           | O(1) |
   | Search         | O(n) |
   -------------------------
+
+  Searches (`contains`, `indexOf`, `count`, `findAll`) use the vectorized
+  kernels in `common/SimdSearch.hpp`.
+
+  `pushN` and `popN` move a batch of elements with one `memcpy` and at
+  most one reallocation, growing or shrinking by as many policy steps as
+  the batch needs. `popN` writes the popped elements in the order they
+  were pushed, so the former top ends up last.
+
+  `saveSnapshot` writes the stack, bottom first, in one write, and
+  `loadSnapshot` restores it with its saved capacity by copying straight
+  out of the mapped file (see `common/Snapshot.hpp`).
 */
 
+#ifndef DSA_STACK_DYNAMIC_ARRAY_CPP
+#define DSA_STACK_DYNAMIC_ARRAY_CPP
+
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include "../common/Allocation.hpp"
+#include "../common/GrowthPolicy.hpp"
+#include "../common/SimdSearch.hpp"
+#include "../common/Snapshot.hpp"
 
+template <typename Policy = DoublingGrowth, typename Allocation = DefaultAllocation>
 class StackDynamicArray
 {
 private:
@@ -22,16 +55,34 @@ private:
   uint _size;
   uint _capacity;
   uint _initialCapacity;
-  bool _shouldIncreaseCapacity() { return this->_size <= this->_capacity && this->_size + 1 > this->_capacity; }
-  bool _shouldDecreaseCapacity() { return this->_size - 1 == this->_capacity / 2; }
+  bool _shouldIncreaseCapacity() { return this->_size == this->_capacity; }
+  bool _shouldDecreaseCapacity() { return this->_capacity > this->_initialCapacity && Policy::shouldShrink(this->_size, this->_capacity); }
+
+  void _reallocate(uint capacity)
+  {
+    auto *tempArrayPtr = Allocation::reallocate(this->_arrayPtr, this->_capacity * sizeof(int), capacity * sizeof(int));
+    this->_arrayPtr = static_cast<int *>(tempArrayPtr);
+    this->_capacity = capacity;
+  }
+
+  // The capacity repeated shrinking settles at for the current size.
+  uint _shrunkCapacity()
+  {
+    auto capacity = this->_capacity;
+    while (capacity > this->_initialCapacity && Policy::shouldShrink(this->_size, capacity)) capacity = Policy::shrink(capacity);
+    if (capacity < this->_initialCapacity) capacity = this->_initialCapacity;
+    if (capacity < this->_size) capacity = this->_size;
+    return capacity;
+  }
 
 public:
   uint size() { return this->_size; }
+  uint capacity() { return this->_capacity; }
   bool empty() { return this->_size == 0; }
 
   StackDynamicArray()
   {
-    this->_arrayPtr = new int[0];
+    this->_arrayPtr = nullptr;
     this->_size = 0;
     this->_capacity = 0;
     this->_initialCapacity = 0;
@@ -39,12 +90,17 @@ public:
 
   StackDynamicArray(uint capacity)
   {
-    this->_arrayPtr = new int[capacity];
+    this->_arrayPtr = static_cast<int *>(Allocation::allocate(capacity * sizeof(int)));
     this->_size = 0;
     this->_capacity = capacity;
     this->_initialCapacity = capacity;
   }
 
+  StackDynamicArray(const StackDynamicArray &) = delete;
+  StackDynamicArray &operator=(const StackDynamicArray &) = delete;
+
+  ~StackDynamicArray() { Allocation::deallocate(this->_arrayPtr, this->_capacity * sizeof(int)); }
+
   void push(int element)
   {
     if (this->_shouldIncreaseCapacity()) this->increaseCapacity();
@@ -54,8 +110,31 @@ public:
   int pop()
   {
     if (this->empty()) throw std::runtime_error("Stack is empty.");
+    auto element = this->_arrayPtr[--this->_size];
     if (this->_shouldDecreaseCapacity()) this->decreaseCapacity();
-    return this->_arrayPtr[this->_size-- - 1];
+    return element;
+  }
+
+  void pushN(const int *elements, uint count)
+  {
+    if (count > this->_capacity - this->_size)
+    {
+      if (count > std::numeric_limits<uint>::max() - this->_size) throw std::length_error("Capacity is too large.");
+      auto capacity = this->_capacity;
+      while (capacity < this->_size + count) capacity = Policy::grow(capacity);
+      this->_reallocate(capacity);
+    }
+    if (count > 0) std::memcpy(this->_arrayPtr + this->_size, elements, count * sizeof(int));
+    this->_size += count;
+  }
+
+  // Pops the top `count` elements into `elements`, bottom-most first.
+  void popN(int *elements, uint count)
+  {
+    if (count > this->_size) throw std::runtime_error("Stack has too few elements.");
+    this->_size -= count;
+    if (count > 0) std::memcpy(elements, this->_arrayPtr + this->_size, count * sizeof(int));
+    if (this->_shouldDecreaseCapacity()) this->_reallocate(this->_shrunkCapacity());
   }
 
   int top()
@@ -67,39 +146,67 @@ public:
   bool contains(int element)
   {
     if (this->empty()) throw std::runtime_error("Stack is empty.");
-    for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) return true;
-    return false;
+    return simd::indexOf(this->_arrayPtr, 0, this->_size, element) != -1;
   }
 
   int indexOf(int element)
   {
     if (this->empty()) throw std::runtime_error("Stack is empty.");
-    for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) return i;
-    return -1;
+    return simd::indexOf(this->_arrayPtr, 0, this->_size, element);
   }
 
-  void increaseCapacity()
+  uint count(int element)
   {
-    if (this->_capacity == 0) this->_capacity = 1;
-    else this->_capacity *= 2;
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    return simd::count(this->_arrayPtr, this->_size, element);
+  }
 
-    auto *tempArrayPtr = new int[this->_capacity];
-    for (uint i = 0; i < this->_size; i++) tempArrayPtr[i] = this->_arrayPtr[i];
+  std::vector<uint> findAll(int element)
+  {
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    std::vector<uint> indices;
+    simd::findAll(this->_arrayPtr, this->_size, element, [&indices](uint index) { indices.push_back(index); });
+    return indices;
+  }
+
+  void saveSnapshot(const std::string &path)
+  {
+    snapshot::Writer<int> writer(path, this->_size, this->_capacity);
+    writer.append(this->_arrayPtr, this->_size);
+    writer.finish();
+  }
 
-    delete[] this->_arrayPtr;
-    this->_arrayPtr = tempArrayPtr;
+  // Replaces the stack with the snapshot at `path`, keeping the capacity it was saved with.
+  void loadSnapshot(const std::string &path)
+  {
+    snapshot::View<int> view(path);
+    auto capacity = std::max(view.capacity(), this->_initialCapacity);
+    auto *arrayPtr = static_cast<int *>(Allocation::allocate(capacity * sizeof(int)));
+    if (view.count() > 0) std::memcpy(arrayPtr, view.data(), view.count() * sizeof(int));
+    Allocation::deallocate(this->_arrayPtr, this->_capacity * sizeof(int));
+    this->_arrayPtr = arrayPtr;
+    this->_size = view.count();
+    this->_capacity = capacity;
   }
 
+  void increaseCapacity() { this->_reallocate(Policy::grow(this->_capacity)); }
+
   void decreaseCapacity()
   {
-    this->_capacity /= 2;
-    if (this->_capacity < this->_initialCapacity) this->_capacity = this->_initialCapacity;
+    auto capacity = Policy::shrink(this->_capacity);
+    if (capacity < this->_initialCapacity) capacity = this->_initialCapacity;
+    if (capacity < this->_size) capacity = this->_size;
+    this->_reallocate(capacity);
+  }
 
-    auto *tempArrayPtr = new int[this->_capacity];
-    for (uint i = 0; i < this->_size; i++) tempArrayPtr[i] = this->_arrayPtr[i];
+  void reserve(uint capacity)
+  {
+    if (capacity > this->_capacity) this->_reallocate(capacity);
+  }
 
-    delete[] this->_arrayPtr;
-    this->_arrayPtr = tempArrayPtr;
+  void shrink_to_fit()
+  {
+    if (this->_size < this->_capacity) this->_reallocate(this->_size);
   }
 
   void toString()
@@ -117,9 +224,10 @@ public:
   }
 };
 
+#ifndef DSA_NO_MAIN
 int main()
 {
-  StackDynamicArray stack(4);
+  StackDynamicArray<> stack(4);
 
   stack.push(1);
   stack.push(2);
@@ -147,7 +255,115 @@ int main()
   assert(stack.indexOf(2) == 1);
   assert(stack.indexOf(3) == -1);
 
+  assert(stack.count(1) == 1);
+  assert(stack.count(3) == 0);
+  assert(stack.findAll(2).size() == 1);
+
   stack.toString();
 
+  StackDynamicArray<> boundary;
+
+  for (int i = 0; i < 8; i++) boundary.push(i);
+  assert(boundary.capacity() == 8);
+
+  for (int i = 0; i < 100; i++)
+  {
+    boundary.push(i);
+    boundary.pop();
+  }
+  assert(boundary.capacity() == 16);
+
+  while (boundary.size() > 4) boundary.pop();
+  assert(boundary.capacity() == 8);
+  assert(boundary.top() == 3);
+
+  boundary.reserve(64);
+  assert(boundary.capacity() == 64);
+  boundary.shrink_to_fit();
+  assert(boundary.capacity() == 4);
+
+  StackDynamicArray<DoublingGrowth, CacheAlignedAllocation> aligned;
+
+  for (int i = 0; i < 1000; i++) aligned.push(i);
+  assert(aligned.capacity() == 1024);
+  assert(aligned.indexOf(999) == 999);
+  while (aligned.size() > 1) aligned.pop();
+  assert(aligned.top() == 0);
+
+  StackDynamicArray<GoldenRatioGrowth> golden;
+  StackDynamicArray<DoublingNoShrinkGrowth> noShrink;
+
+  for (int i = 0; i < 10; i++)
+  {
+    golden.push(i);
+    noShrink.push(i);
+  }
+  assert(golden.capacity() == 14);
+
+  while (!noShrink.empty()) noShrink.pop();
+  assert(noShrink.capacity() == 16);
+
+  StackDynamicArray<> batched;
+  std::vector<int> batch(300);
+  for (int i = 0; i < 300; i++) batch[i] = i;
+
+  batched.push(-1);
+  batched.pushN(batch.data(), 300);
+  assert(batched.size() == 301 && batched.capacity() == 512);
+  assert(batched.top() == 299 && batched.indexOf(0) == 1);
+  batched.pushN(batch.data(), 0);
+  assert(batched.capacity() == 512);
+
+  std::vector<int> popped(300);
+  batched.popN(popped.data(), 290);
+  assert(popped[0] == 10 && popped[289] == 299);
+  assert(batched.size() == 11 && batched.capacity() == 32);
+  assert(batched.top() == 9);
+
+  bool isShort = false;
+  try
+  {
+    batched.popN(popped.data(), 12);
+  }
+  catch (const std::runtime_error &)
+  {
+    isShort = true;
+  }
+  assert(isShort == true && batched.size() == 11);
+
+  batched.popN(popped.data(), 11);
+  assert(popped[0] == -1 && popped[10] == 9);
+  assert(batched.empty() == true && batched.capacity() == 1);
+
+  StackDynamicArray<> floor(64);
+  floor.pushN(batch.data(), 100);
+  assert(floor.capacity() == 128);
+  floor.popN(popped.data(), 100);
+  assert(floor.capacity() == 64);
+
+  char pathTemplate[] = "/tmp/StackDynamicArray.snapshot.XXXXXX";
+  auto fileDescriptor = mkstemp(pathTemplate);
+  assert(fileDescriptor != -1);
+  close(fileDescriptor);
+  const std::string path = pathTemplate;
+  floor.pushN(batch.data(), 300);
+  floor.saveSnapshot(path);
+
+  StackDynamicArray<> restored;
+  restored.push(-1);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 300 && restored.capacity() == floor.capacity());
+  assert(restored.top() == 299 && restored.indexOf(0) == 0);
+  restored.popN(popped.data(), 300);
+  for (int i = 0; i < 300; i++) assert(popped[i] == i);
+
+  StackDynamicArray<> atLeast(1024);
+  atLeast.loadSnapshot(path);
+  assert(atLeast.size() == 300 && atLeast.capacity() == 1024);
+  unlink(path.c_str());
+
   return 0;
 }
+#endif
+
+#endif
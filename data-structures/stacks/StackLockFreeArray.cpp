@@ -0,0 +1,333 @@
+/*
+  Data Structures | Stack (Lock-Free Array)
+
+  This stack implementation will only cover `int` data types.
+
+  --- Time Complexities ---
+  | Push           | O(1) |
+  | Pop            | O(1) |
+  -------------------------
+  (lock-free: O(1) per attempt, retried under contention)
+
+  A bounded stack that any number of threads can push to and pop from at
+  once without a lock, and that never allocates after construction. All
+  `capacity` cells are allocated up front. Cells are linked by 32-bit
+  index into two Treiber stacks: the stack itself, and a free list of
+  unused cells. A push takes a cell from the free list, writes the value
+  into it and links it onto the stack; a pop unlinks the top cell, reads
+  it and returns it to the free list. Each top is a 64-bit word holding a
+  cell index and a 32-bit tag that every swap bumps, which rules out ABA.
+  Cells are never freed, so no reclamation scheme is needed.
+
+  When a compare-and-swap on the stack fails because another thread got
+  there first, the operation tries the elimination array before retrying.
+  A push parks its value in a random slot for a short spin; a pop that
+  finds a parked value takes it. The pair then completes without touching
+  the stack at all, so under heavy push/pop contention the top stops being
+  the bottleneck.
+
+  `tryPush`/`tryPop` report a full or empty stack by returning false;
+  `push`/`pop` throw like `StackStaticArray`. A push can see the stack
+  as full for the moment between a pop unlinking a cell and returning it
+  to the free list.
+
+  Where the cells come from is chosen by the `Allocation` template
+  parameter (see `common/Allocation.hpp`).
+*/
+
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <thread>
+#include "../common/Allocation.hpp"
+
+template <typename Allocation = DefaultAllocation>
+class StackLockFreeArray
+{
+private:
+  typedef unsigned int uint;
+  typedef std::uint64_t Word;
+  static const uint _null = 0xFFFFFFFFu;
+  static const uint _eliminationSlots = 8;
+  static const uint _eliminationSpins = 64;
+
+  // Elimination slot states, kept in the low two bits of the slot word.
+  static const Word _slotEmpty = 0;
+  static const Word _slotOffered = 1;
+  static const Word _slotTaken = 2;
+
+  struct Cell
+  {
+    int data;
+    std::atomic<uint> nextIndex;
+  };
+
+  struct alignas(64) EliminationSlot
+  {
+    std::atomic<Word> word;
+  };
+
+  Cell *_cellsPtr;
+  uint _capacity;
+  alignas(64) std::atomic<Word> _top;
+  alignas(64) std::atomic<Word> _free;
+  EliminationSlot _elimination[_eliminationSlots];
+
+  static uint _indexOf(Word word) { return (uint)word; }
+  static Word _pack(uint index, Word previous) { return (Word)index | ((previous & ~(Word)_null) + ((Word)1 << 32)); }
+
+  // Slot words hold the state in bits 0-1, a tag in bits 2-31 and the offered value in bits 32-63.
+  static Word _slotWord(Word state, Word previous, int data)
+  {
+    return state | ((previous + 4) & 0xFFFFFFFCu) | ((Word)(uint)data << 32);
+  }
+
+  static void _pause()
+  {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+  }
+
+  static uint _randomSlot()
+  {
+    thread_local uint seed = (uint)std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed % _eliminationSlots;
+  }
+
+  // Makes one attempt to link cell `index` onto `head`.
+  bool _tryLink(std::atomic<Word> &head, uint index)
+  {
+    auto current = head.load(std::memory_order_relaxed);
+    this->_cellsPtr[index].nextIndex.store(_indexOf(current), std::memory_order_relaxed);
+    return head.compare_exchange_strong(current, _pack(index, current), std::memory_order_release,
+                                        std::memory_order_relaxed);
+  }
+
+  void _link(std::atomic<Word> &head, uint index)
+  {
+    while (!this->_tryLink(head, index));
+  }
+
+  // Unlinks the first cell of `head`, or returns _null when it is empty. A failed swap returns _null
+  // through `isContended` instead of retrying when `isContended` is given.
+  uint _unlink(std::atomic<Word> &head, bool *isContended)
+  {
+    auto current = head.load(std::memory_order_acquire);
+    while (true)
+    {
+      auto index = _indexOf(current);
+      if (index == _null) return _null;
+      auto nextIndex = this->_cellsPtr[index].nextIndex.load(std::memory_order_relaxed);
+      if (head.compare_exchange_weak(current, _pack(nextIndex, current), std::memory_order_acq_rel,
+                                     std::memory_order_acquire))
+        return index;
+      if (isContended != nullptr)
+      {
+        *isContended = true;
+        return _null;
+      }
+    }
+  }
+
+  bool _eliminatePush(int data)
+  {
+    auto &slot = this->_elimination[_randomSlot()].word;
+    auto current = slot.load(std::memory_order_relaxed);
+    if ((current & 3) != _slotEmpty) return false;
+    auto offer = _slotWord(_slotOffered, current, data);
+    if (!slot.compare_exchange_strong(current, offer, std::memory_order_acq_rel, std::memory_order_relaxed)) return false;
+    for (uint spin = 0; spin < _eliminationSpins && slot.load(std::memory_order_acquire) == offer; spin++) _pause();
+    auto expected = offer;
+    auto withdrawn = _slotWord(_slotEmpty, offer, 0);
+    if (slot.compare_exchange_strong(expected, withdrawn, std::memory_order_acq_rel, std::memory_order_acquire))
+      return false;
+    // A pop took the offer and left the slot marked taken; only this thread may empty it again.
+    slot.store(withdrawn, std::memory_order_release);
+    return true;
+  }
+
+  bool _eliminatePop(int &data)
+  {
+    auto &slot = this->_elimination[_randomSlot()].word;
+    auto current = slot.load(std::memory_order_acquire);
+    if ((current & 3) != _slotOffered) return false;
+    auto taken = (current & 0xFFFFFFFCu) | _slotTaken;
+    if (!slot.compare_exchange_strong(current, taken, std::memory_order_acq_rel, std::memory_order_relaxed)) return false;
+    data = (int)(uint)(current >> 32);
+    return true;
+  }
+
+public:
+  uint capacity() { return this->_capacity; }
+  bool empty() { return _indexOf(this->_top.load(std::memory_order_acquire)) == _null; }
+
+  StackLockFreeArray(uint capacity)
+  {
+    if (capacity >= _null) throw std::length_error("Capacity is too large.");
+    this->_cellsPtr = static_cast<Cell *>(Allocation::allocate(capacity * sizeof(Cell)));
+    this->_capacity = capacity;
+    for (uint i = 0; i < capacity; i++)
+    {
+      new (&this->_cellsPtr[i]) Cell();
+      this->_cellsPtr[i].nextIndex.store(i + 1 == capacity ? _null : i + 1, std::memory_order_relaxed);
+    }
+    this->_top.store(_null, std::memory_order_relaxed);
+    this->_free.store(capacity == 0 ? _null : 0, std::memory_order_relaxed);
+    for (auto &slot : this->_elimination) slot.word.store(_slotEmpty, std::memory_order_relaxed);
+  }
+
+  StackLockFreeArray(const StackLockFreeArray &) = delete;
+  StackLockFreeArray &operator=(const StackLockFreeArray &) = delete;
+
+  // No thread may use the stack while it is destroyed.
+  ~StackLockFreeArray()
+  {
+    for (uint i = 0; i < this->_capacity; i++) this->_cellsPtr[i].~Cell();
+    Allocation::deallocate(this->_cellsPtr, this->_capacity * sizeof(Cell));
+  }
+
+  // Pushes `data` and returns true, or returns false if the stack was full.
+  bool tryPush(int data)
+  {
+    auto index = this->_unlink(this->_free, nullptr);
+    if (index == _null) return false;
+    this->_cellsPtr[index].data = data;
+    while (!this->_tryLink(this->_top, index))
+    {
+      if (!this->_eliminatePush(data)) continue;
+      this->_link(this->_free, index);
+      return true;
+    }
+    return true;
+  }
+
+  // Pops into `data` and returns true, or returns false if the stack was empty.
+  bool tryPop(int &data)
+  {
+    while (true)
+    {
+      bool isContended = false;
+      auto index = this->_unlink(this->_top, &isContended);
+      if (index != _null)
+      {
+        data = this->_cellsPtr[index].data;
+        this->_link(this->_free, index);
+        return true;
+      }
+      if (!isContended) return false;
+      if (this->_eliminatePop(data)) return true;
+    }
+  }
+
+  void push(int data)
+  {
+    if (!this->tryPush(data)) throw std::runtime_error("Stack is full.");
+  }
+
+  int pop()
+  {
+    int data;
+    if (!this->tryPop(data)) throw std::runtime_error("Stack is empty.");
+    return data;
+  }
+
+  // Only meaningful while no other thread is using the stack.
+  void toString()
+  {
+    auto index = _indexOf(this->_top.load(std::memory_order_acquire));
+    if (index == _null)
+    {
+      std::cout << "Stack is empty." << std::endl;
+      return;
+    }
+    std::cout << "Top: " << this->_cellsPtr[index].data << std::endl;
+    for (; index != _null; index = this->_cellsPtr[index].nextIndex.load(std::memory_order_relaxed))
+    {
+      auto nextIndex = this->_cellsPtr[index].nextIndex.load(std::memory_order_relaxed);
+      if (nextIndex == _null) std::cout << this->_cellsPtr[index].data;
+      else std::cout << this->_cellsPtr[index].data << " -> ";
+    }
+    std::cout << std::endl;
+    std::cout << "Capacity: " << this->_capacity << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+#include <vector>
+
+int main()
+{
+  StackLockFreeArray<> stack(4);
+
+  stack.push(1);
+  stack.push(2);
+  stack.push(3);
+  stack.push(4);
+
+  assert(stack.tryPush(5) == false);
+  assert(stack.capacity() == 4);
+
+  stack.toString();
+
+  assert(stack.pop() == 4);
+  assert(stack.pop() == 3);
+  assert(stack.tryPush(6) == true);
+  assert(stack.pop() == 6);
+
+  int data;
+  assert(stack.tryPop(data) == true && data == 2);
+  assert(stack.tryPop(data) == true && data == 1);
+  assert(stack.tryPop(data) == false);
+  assert(stack.empty() == true);
+
+  // Every value pushed must be popped exactly once, whether it went through the array or was eliminated.
+  const int threads = 4;
+  const int perThread = 50000;
+  StackLockFreeArray<CacheAlignedAllocation> shared(64);
+  std::vector<std::vector<int>> popped(threads);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++)
+  {
+    workers.emplace_back([&, t] {
+      for (int i = 0; i < perThread; i++)
+      {
+        while (!shared.tryPush(t * perThread + i));
+        int value;
+        if (i % 2 == 1)
+        {
+          while (!shared.tryPop(value));
+          popped[t].push_back(value);
+          while (!shared.tryPop(value));
+          popped[t].push_back(value);
+        }
+      }
+    });
+  }
+  for (auto &worker : workers) worker.join();
+
+  assert(shared.empty() == true);
+  std::vector<bool> seen(threads * perThread, false);
+  for (auto &values : popped)
+  {
+    for (auto value : values)
+    {
+      assert(seen[value] == false);
+      seen[value] = true;
+    }
+  }
+  for (auto wasSeen : seen) assert(wasSeen == true);
+
+  // Every cell made it back to the free list.
+  for (int i = 0; i < 64; i++) assert(shared.tryPush(i) == true);
+  assert(shared.tryPush(64) == false);
+
+  return 0;
+}
+#endif
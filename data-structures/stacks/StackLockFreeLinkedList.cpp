@@ -0,0 +1,236 @@
+/*
+  Data Structures | Stack (Lock-Free Linked List)
+
+  This stack implementation will only cover `int` data types.
+
+  A Treiber stack that any number of threads can push to and pop from at
+  once without a lock. The top of the stack is one atomic word, and push
+  and pop each retry a single compare-and-swap on it until no other thread
+  got there first.
+
+  The word packs the top node's address into its low 48 bits and a 16-bit
+  tag into the high bits. Every successful swap bumps the tag, so a
+  compare-and-swap that read the word before a pop and a push of the same
+  address fails instead of installing a stale `nextPtr` (the ABA problem).
+  Popped nodes are retired through hazard pointers (see
+  `common/HazardPointers.hpp`), so a thread that is still reading a node
+  cannot see it freed underneath it. This assumes user-space addresses fit
+  in 48 bits, which holds on x86-64 and AArch64 Linux.
+
+  There is no `size()`: a shared counter would put every thread back on
+  the same cache line. `toString()` must not run concurrently with `pop()`.
+
+  --- Time Complexities ---
+  | Push           | O(1) |
+  | Pop            | O(1) |
+  | Peek           | O(1) |
+  -------------------------
+  (lock-free: O(1) per attempt, retried under contention)
+*/
+
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <cstdint>
+#include "../common/HazardPointers.hpp"
+
+class LockFreeNode
+{
+public:
+  int data;
+  LockFreeNode *nextPtr;
+
+  LockFreeNode(int data)
+  {
+    this->data = data;
+    this->nextPtr = nullptr;
+  }
+};
+
+class StackLockFreeLinkedList
+{
+  static_assert(sizeof(void *) == 8, "Tagged pointers need a 64-bit address space.");
+
+private:
+  typedef unsigned int uint;
+  typedef std::uint64_t Word;
+  static const Word _pointerMask = (Word(1) << 48) - 1;
+  alignas(64) std::atomic<Word> _top;
+  HazardPointers<1> _hazardPointers;
+
+  static LockFreeNode *_nodeOf(Word word) { return reinterpret_cast<LockFreeNode *>(word & _pointerMask); }
+
+  // Packs `nodePtr` with the tag of `previous` plus one.
+  static Word _pack(LockFreeNode *nodePtr, Word previous)
+  {
+    return reinterpret_cast<std::uintptr_t>(nodePtr) | ((previous & ~_pointerMask) + (_pointerMask + 1));
+  }
+
+  // Reads the top node under hazard slot 0, or returns nullptr when the stack is empty.
+  LockFreeNode *_protectTop(HazardPointers<1>::Guard &guard, Word &top)
+  {
+    top = this->_top.load(std::memory_order_acquire);
+    while (true)
+    {
+      auto *nodePtr = _nodeOf(top);
+      if (nodePtr == nullptr) return nullptr;
+      guard.set(0, nodePtr);
+      auto current = this->_top.load(std::memory_order_seq_cst);
+      if (current == top) return nodePtr;
+      top = current;
+    }
+  }
+
+public:
+  bool empty() { return _nodeOf(this->_top.load(std::memory_order_acquire)) == nullptr; }
+
+  StackLockFreeLinkedList() { this->_top.store(0, std::memory_order_relaxed); }
+
+  StackLockFreeLinkedList(const StackLockFreeLinkedList &) = delete;
+  StackLockFreeLinkedList &operator=(const StackLockFreeLinkedList &) = delete;
+
+  // No thread may use the stack while it is destroyed.
+  ~StackLockFreeLinkedList()
+  {
+    auto *nodePtr = _nodeOf(this->_top.load(std::memory_order_acquire));
+    while (nodePtr != nullptr)
+    {
+      auto *nextNodePtr = nodePtr->nextPtr;
+      delete nodePtr;
+      nodePtr = nextNodePtr;
+    }
+  }
+
+  void push(int data)
+  {
+    auto *newNodePtr = new LockFreeNode(data);
+    auto top = this->_top.load(std::memory_order_relaxed);
+    do newNodePtr->nextPtr = _nodeOf(top);
+    while (!this->_top.compare_exchange_weak(top, _pack(newNodePtr, top), std::memory_order_release,
+                                             std::memory_order_relaxed));
+  }
+
+  // Pops into `data` and returns true, or returns false if the stack was empty.
+  bool tryPop(int &data)
+  {
+    HazardPointers<1>::Guard guard(this->_hazardPointers);
+    Word top;
+    while (true)
+    {
+      auto *nodePtr = this->_protectTop(guard, top);
+      if (nodePtr == nullptr) return false;
+      if (this->_top.compare_exchange_weak(top, _pack(nodePtr->nextPtr, top), std::memory_order_acq_rel,
+                                           std::memory_order_acquire))
+      {
+        data = nodePtr->data;
+        guard.clear(0);
+        guard.retire(nodePtr);
+        return true;
+      }
+    }
+  }
+
+  int pop()
+  {
+    int data;
+    if (!this->tryPop(data)) throw std::runtime_error("Stack is empty.");
+    return data;
+  }
+
+  int top()
+  {
+    HazardPointers<1>::Guard guard(this->_hazardPointers);
+    Word top;
+    auto *nodePtr = this->_protectTop(guard, top);
+    if (nodePtr == nullptr) throw std::runtime_error("Stack is empty.");
+    return nodePtr->data;
+  }
+
+  void toString()
+  {
+    auto *traversalPtr = _nodeOf(this->_top.load(std::memory_order_acquire));
+    if (traversalPtr == nullptr)
+    {
+      std::cout << "Stack is empty." << std::endl;
+      return;
+    }
+    std::cout << "Top: " << traversalPtr->data << std::endl;
+    while (traversalPtr != nullptr)
+    {
+      if (traversalPtr->nextPtr == nullptr) std::cout << traversalPtr->data;
+      else std::cout << traversalPtr->data << " -> ";
+      traversalPtr = traversalPtr->nextPtr;
+    }
+    std::cout << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+#include <thread>
+#include <vector>
+
+int main()
+{
+  StackLockFreeLinkedList stack;
+
+  stack.push(1);
+  stack.push(2);
+
+  assert(stack.top() == 2);
+  assert(stack.empty() == false);
+
+  stack.push(3);
+  stack.push(4);
+
+  assert(stack.top() == 4);
+  assert(stack.pop() == 4);
+  assert(stack.pop() == 3);
+  assert(stack.top() == 2);
+
+  stack.toString();
+
+  int data;
+  assert(stack.tryPop(data) == true && data == 2);
+  assert(stack.tryPop(data) == true && data == 1);
+  assert(stack.tryPop(data) == false);
+  assert(stack.empty() == true);
+
+  // Every thread pushes its own values and pops as many as it pushed; each value must come out exactly once.
+  const int threads = 4;
+  const int perThread = 20000;
+  std::vector<std::vector<int>> popped(threads);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++)
+  {
+    workers.emplace_back([&, t] {
+      for (int i = 0; i < perThread; i++)
+      {
+        stack.push(t * perThread + i);
+        if (i % 2 == 1)
+        {
+          int value;
+          while (!stack.tryPop(value));
+          popped[t].push_back(value);
+          while (!stack.tryPop(value));
+          popped[t].push_back(value);
+        }
+      }
+    });
+  }
+  for (auto &worker : workers) worker.join();
+
+  assert(stack.empty() == true);
+  std::vector<bool> seen(threads * perThread, false);
+  for (auto &values : popped)
+  {
+    for (auto value : values)
+    {
+      assert(seen[value] == false);
+      seen[value] = true;
+    }
+  }
+  for (auto wasSeen : seen) assert(wasSeen == true);
+
+  return 0;
+}
+#endif
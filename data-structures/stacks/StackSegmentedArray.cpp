@@ -0,0 +1,280 @@
+/*
+  Data Structures | Stack (Segmented Array)
+
+  This stack implementation will only cover `int` data types.
+
+  The stack is a linked list of fixed-size chunks of `ChunkSize` elements,
+  newest on top. A push that fills the top chunk links a new chunk above
+  it, and a pop that empties the top chunk unlinks it. Nothing is ever
+  copied, so pushes and pops are O(1) in the worst case, not just
+  amortized, and an element keeps its address for as long as it is on the
+  stack. Growth needs one more chunk of memory, not a second buffer the
+  size of the whole stack.
+
+  The last chunk to empty is kept as a spare rather than freed, and the
+  next chunk the stack needs is the spare. A stack that pushes and pops
+  across a chunk boundary therefore never calls the allocator. When a
+  second chunk empties, the older spare is freed.
+
+  Where the chunks come from is chosen by the `Allocation` template
+  parameter (see `common/Allocation.hpp`).
+
+  --- Time Complexities ---
+  | Push           | O(1) |
+  | Pop            | O(1) |
+  | Peek           | O(1) |
+  | Search         | O(n) |
+  -------------------------
+
+  Searches (`contains`, `indexOf`, `count`, `findAll`) run the vectorized
+  kernels in `common/SimdSearch.hpp` over one chunk at a time.
+*/
+
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include "../common/Allocation.hpp"
+#include "../common/SimdSearch.hpp"
+
+template <unsigned int ChunkSize = 1024, typename Allocation = DefaultAllocation>
+class StackSegmentedArray
+{
+  static_assert(ChunkSize > 0, "Chunks must hold at least one element.");
+
+private:
+  typedef unsigned int uint;
+
+  struct Chunk
+  {
+    Chunk *previousPtr;
+    int elements[ChunkSize];
+  };
+
+  Chunk *_topChunkPtr;
+  Chunk *_spareChunkPtr;
+  uint _topCount;
+  uint _size;
+  uint _chunks;
+
+  void _pushChunk()
+  {
+    auto *chunkPtr = this->_spareChunkPtr;
+    if (chunkPtr == nullptr) chunkPtr = static_cast<Chunk *>(Allocation::allocate(sizeof(Chunk)));
+    this->_spareChunkPtr = nullptr;
+    chunkPtr->previousPtr = this->_topChunkPtr;
+    this->_topChunkPtr = chunkPtr;
+    this->_topCount = 0;
+    this->_chunks++;
+  }
+
+  void _popChunk()
+  {
+    auto *chunkPtr = this->_topChunkPtr;
+    this->_topChunkPtr = chunkPtr->previousPtr;
+    this->_topCount = this->_topChunkPtr == nullptr ? 0 : ChunkSize;
+    if (this->_spareChunkPtr != nullptr) Allocation::deallocate(this->_spareChunkPtr, sizeof(Chunk));
+    this->_spareChunkPtr = chunkPtr;
+    this->_chunks--;
+  }
+
+  // The chunks from the bottom of the stack to the top.
+  std::vector<Chunk *> _chunksFromBottom()
+  {
+    std::vector<Chunk *> chunks(this->_chunks);
+    auto *chunkPtr = this->_topChunkPtr;
+    for (uint i = this->_chunks; i > 0; i--, chunkPtr = chunkPtr->previousPtr) chunks[i - 1] = chunkPtr;
+    return chunks;
+  }
+
+  uint _countIn(uint chunk) { return chunk + 1 == this->_chunks ? this->_topCount : ChunkSize; }
+
+public:
+  uint size() { return this->_size; }
+  bool empty() { return this->_size == 0; }
+
+  // Elements the allocated chunks can hold, counting the spare.
+  uint capacity() { return (this->_chunks + (this->_spareChunkPtr != nullptr)) * ChunkSize; }
+
+  StackSegmentedArray()
+  {
+    this->_topChunkPtr = nullptr;
+    this->_spareChunkPtr = nullptr;
+    this->_topCount = 0;
+    this->_size = 0;
+    this->_chunks = 0;
+  }
+
+  StackSegmentedArray(const StackSegmentedArray &) = delete;
+  StackSegmentedArray &operator=(const StackSegmentedArray &) = delete;
+
+  ~StackSegmentedArray()
+  {
+    while (this->_topChunkPtr != nullptr) this->_popChunk();
+    this->shrink_to_fit();
+  }
+
+  void push(int element)
+  {
+    if (this->_topCount == ChunkSize || this->_topChunkPtr == nullptr) this->_pushChunk();
+    this->_topChunkPtr->elements[this->_topCount++] = element;
+    this->_size++;
+  }
+
+  int pop()
+  {
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    auto element = this->_topChunkPtr->elements[--this->_topCount];
+    this->_size--;
+    if (this->_topCount == 0) this->_popChunk();
+    return element;
+  }
+
+  int top()
+  {
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    return this->_topChunkPtr->elements[this->_topCount - 1];
+  }
+
+  bool contains(int element)
+  {
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    return this->indexOf(element) != -1;
+  }
+
+  int indexOf(int element)
+  {
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    auto chunks = this->_chunksFromBottom();
+    for (uint i = 0; i < chunks.size(); i++)
+    {
+      auto index = simd::indexOf(chunks[i]->elements, 0, this->_countIn(i), element);
+      if (index != -1) return i * ChunkSize + index;
+    }
+    return -1;
+  }
+
+  uint count(int element)
+  {
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    uint total = 0;
+    auto chunks = this->_chunksFromBottom();
+    for (uint i = 0; i < chunks.size(); i++) total += simd::count(chunks[i]->elements, this->_countIn(i), element);
+    return total;
+  }
+
+  std::vector<uint> findAll(int element)
+  {
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    std::vector<uint> indices;
+    auto chunks = this->_chunksFromBottom();
+    for (uint i = 0; i < chunks.size(); i++)
+    {
+      auto offset = i * ChunkSize;
+      simd::findAll(chunks[i]->elements, this->_countIn(i), element,
+                    [&indices, offset](uint index) { indices.push_back(offset + index); });
+    }
+    return indices;
+  }
+
+  // Frees the spare chunk.
+  void shrink_to_fit()
+  {
+    if (this->_spareChunkPtr == nullptr) return;
+    Allocation::deallocate(this->_spareChunkPtr, sizeof(Chunk));
+    this->_spareChunkPtr = nullptr;
+  }
+
+  void toString()
+  {
+    auto chunks = this->_chunksFromBottom();
+    for (uint i = 0; i < chunks.size(); i++)
+    {
+      for (uint j = 0; j < this->_countIn(i); j++)
+      {
+        if (i + 1 == chunks.size() && j + 1 == this->_countIn(i)) std::cout << chunks[i]->elements[j];
+        else std::cout << chunks[i]->elements[j] << " -> ";
+      }
+    }
+    std::cout << std::endl;
+    std::cout << "Top: " << this->top() << std::endl;
+    std::cout << "Size: " << this->_size << std::endl;
+    std::cout << "Capacity: " << this->capacity() << std::endl;
+  }
+};
+
+#ifndef DSA_NO_MAIN
+int main()
+{
+  StackSegmentedArray<4> stack;
+
+  stack.push(1);
+  stack.push(2);
+
+  assert(stack.top() == 2);
+  assert(stack.size() == 2);
+
+  stack.push(3);
+  stack.push(4);
+  stack.push(5);
+
+  assert(stack.top() == 5);
+  assert(stack.size() == 5);
+  assert(stack.capacity() == 8);
+
+  assert(stack.pop() == 5);
+  assert(stack.capacity() == 8);
+  assert(stack.pop() == 4);
+  assert(stack.pop() == 3);
+
+  assert(stack.top() == 2);
+  assert(stack.size() == 2);
+
+  assert(stack.contains(1) == true);
+  assert(stack.contains(2) == true);
+  assert(stack.contains(3) == false);
+
+  assert(stack.indexOf(1) == 0);
+  assert(stack.indexOf(2) == 1);
+  assert(stack.indexOf(3) == -1);
+
+  assert(stack.count(1) == 1);
+  assert(stack.count(3) == 0);
+  assert(stack.findAll(2).size() == 1);
+
+  stack.toString();
+
+  StackSegmentedArray<8> boundary;
+
+  for (int i = 0; i < 8; i++) boundary.push(i);
+  for (int i = 0; i < 100; i++)
+  {
+    boundary.push(i);
+    boundary.pop();
+  }
+  assert(boundary.capacity() == 16);
+
+  for (int i = 0; i < 30; i++) boundary.push(i % 5);
+  assert(boundary.size() == 38);
+  assert(boundary.capacity() == 40);
+  assert(boundary.indexOf(4) == 4);
+  assert(boundary.indexOf(-1) == -1);
+  assert(boundary.count(4) == 7);
+  auto fours = boundary.findAll(4);
+  assert(fours.size() == 7 && fours[0] == 4 && fours[1] == 12 && fours[6] == 37);
+
+  while (!boundary.empty()) boundary.pop();
+  assert(boundary.capacity() == 8);
+  boundary.shrink_to_fit();
+  assert(boundary.capacity() == 0);
+
+  StackSegmentedArray<1024, CacheAlignedAllocation> aligned;
+
+  for (int i = 0; i < 5000; i++) aligned.push(i);
+  assert(aligned.indexOf(4999) == 4999);
+  assert(aligned.capacity() == 5120);
+  while (aligned.size() > 1) aligned.pop();
+  assert(aligned.top() == 0);
+
+  return 0;
+}
+#endif
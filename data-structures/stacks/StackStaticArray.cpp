@@ -6,14 +6,38 @@
   --- Time Complexities ---
   | Push           | O(1) |
   | Pop            | O(1) |
+  | Push k         | O(k) |
+  | Pop k          | O(k) |
   | Peek           | O(1) |
   | Search         | O(n) |
   -------------------------
+
+  Searches (`contains`, `indexOf`, `count`, `findAll`) use the vectorized
+  kernels in `common/SimdSearch.hpp`.
+
+  `pushN` and `popN` move a batch of elements with one bounds check and
+  one `memcpy`. `popN` writes the popped elements in the order they were
+  pushed, so the former top ends up last and `pushN` on the same buffer
+  restores the stack. A batch that does not fit throws before anything is
+  moved.
+
+  Where the buffer comes from is chosen by the `Allocation` template
+  parameter (see `common/Allocation.hpp`).
+
+  `saveSnapshot` writes the stack, bottom first, in one write, and
+  `loadSnapshot` restores it with its saved capacity by copying straight
+  out of the mapped file (see `common/Snapshot.hpp`).
 */
 
 #include <iostream>
 #include <cassert>
+#include <cstring>
+#include <vector>
+#include "../common/Allocation.hpp"
+#include "../common/SimdSearch.hpp"
+#include "../common/Snapshot.hpp"
 
+template <typename Allocation = DefaultAllocation>
 class StackStaticArray
 {
 private:
@@ -29,11 +53,16 @@ public:
 
   StackStaticArray(uint capacity)
   {
-    this->_arrayPtr = new int[capacity];
+    this->_arrayPtr = static_cast<int *>(Allocation::allocate(capacity * sizeof(int)));
     this->_size = 0;
     this->_capacity = capacity;
   }
 
+  StackStaticArray(const StackStaticArray &) = delete;
+  StackStaticArray &operator=(const StackStaticArray &) = delete;
+
+  ~StackStaticArray() { Allocation::deallocate(this->_arrayPtr, this->_capacity * sizeof(int)); }
+
   void push(int element)
   {
     if (this->_isFull()) throw std::runtime_error("Stack is full.");
@@ -46,6 +75,21 @@ public:
     return this->_arrayPtr[this->_size-- - 1];
   }
 
+  void pushN(const int *elements, uint count)
+  {
+    if (count > this->_capacity - this->_size) throw std::runtime_error("Stack is full.");
+    if (count > 0) std::memcpy(this->_arrayPtr + this->_size, elements, count * sizeof(int));
+    this->_size += count;
+  }
+
+  // Pops the top `count` elements into `elements`, bottom-most first.
+  void popN(int *elements, uint count)
+  {
+    if (count > this->_size) throw std::runtime_error("Stack has too few elements.");
+    this->_size -= count;
+    if (count > 0) std::memcpy(elements, this->_arrayPtr + this->_size, count * sizeof(int));
+  }
+
   int top()
   {
     if (this->empty()) throw std::runtime_error("Stack is empty.");
@@ -55,15 +99,47 @@ public:
   bool contains(int element)
   {
     if (this->empty()) throw std::runtime_error("Stack is empty.");
-    for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) return true;
-    return false;
+    return simd::indexOf(this->_arrayPtr, 0, this->_size, element) != -1;
   }
 
   int indexOf(int element)
   {
     if (this->empty()) throw std::runtime_error("Stack is empty.");
-    for (uint i = 0; i < this->_size; i++) if (this->_arrayPtr[i] == element) return i;
-    return -1;
+    return simd::indexOf(this->_arrayPtr, 0, this->_size, element);
+  }
+
+  uint count(int element)
+  {
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    return simd::count(this->_arrayPtr, this->_size, element);
+  }
+
+  std::vector<uint> findAll(int element)
+  {
+    if (this->empty()) throw std::runtime_error("Stack is empty.");
+    std::vector<uint> indices;
+    simd::findAll(this->_arrayPtr, this->_size, element, [&indices](uint index) { indices.push_back(index); });
+    return indices;
+  }
+
+  void saveSnapshot(const std::string &path)
+  {
+    snapshot::Writer<int> writer(path, this->_size, this->_capacity);
+    writer.append(this->_arrayPtr, this->_size);
+    writer.finish();
+  }
+
+  // Replaces the stack with the snapshot at `path`, keeping the capacity it was saved with.
+  void loadSnapshot(const std::string &path)
+  {
+    snapshot::View<int> view(path);
+    auto capacity = view.capacity();
+    auto *arrayPtr = static_cast<int *>(Allocation::allocate(capacity * sizeof(int)));
+    if (view.count() > 0) std::memcpy(arrayPtr, view.data(), view.count() * sizeof(int));
+    Allocation::deallocate(this->_arrayPtr, this->_capacity * sizeof(int));
+    this->_arrayPtr = arrayPtr;
+    this->_size = view.count();
+    this->_capacity = capacity;
   }
 
   void toString()
@@ -80,9 +156,10 @@ public:
   }
 };
 
+#ifndef DSA_NO_MAIN
 int main()
 {
-  StackStaticArray stack(4);
+  StackStaticArray<> stack(4);
 
   stack.push(1);
   stack.push(2);
@@ -110,7 +187,87 @@ int main()
   assert(stack.indexOf(2) == 1);
   assert(stack.indexOf(3) == -1);
 
+  assert(stack.count(1) == 1);
+  assert(stack.count(3) == 0);
+  assert(stack.findAll(2).size() == 1);
+
   stack.toString();
 
+  StackStaticArray<> wide(1003);
+
+  for (int i = 0; i < 1003; i++) wide.push(i % 7 == 0 ? i : -1);
+
+  assert(wide.contains(1001) == true);
+  assert(wide.contains(1002) == false);
+  assert(wide.indexOf(1001) == 1001);
+  assert(wide.indexOf(-2) == -1);
+  assert(wide.count(-1) == 1003 - 144);
+
+  auto matches = wide.findAll(-1);
+  assert(matches.size() == wide.count(-1));
+  assert(matches[0] == 1 && matches[matches.size() - 1] == 1002);
+
+  StackStaticArray<> batched(8);
+  int batch[] = {10, 11, 12, 13, 14};
+
+  batched.push(9);
+  batched.pushN(batch, 5);
+  assert(batched.size() == 6 && batched.top() == 14);
+
+  bool isFull = false;
+  try
+  {
+    batched.pushN(batch, 3);
+  }
+  catch (const std::runtime_error &)
+  {
+    isFull = true;
+  }
+  assert(isFull == true && batched.size() == 6);
+
+  int popped[6];
+  batched.popN(popped, 3);
+  assert(popped[0] == 12 && popped[1] == 13 && popped[2] == 14);
+  assert(batched.top() == 11);
+  batched.pushN(popped, 3);
+  batched.popN(popped, 6);
+  assert(popped[0] == 9 && popped[5] == 14 && batched.empty() == true);
+  batched.popN(popped, 0);
+
+  bool isShort = false;
+  try
+  {
+    batched.popN(popped, 1);
+  }
+  catch (const std::runtime_error &)
+  {
+    isShort = true;
+  }
+  assert(isShort == true);
+
+  char pathTemplate[] = "/tmp/StackStaticArray.snapshot.XXXXXX";
+  auto fileDescriptor = mkstemp(pathTemplate);
+  assert(fileDescriptor != -1);
+  close(fileDescriptor);
+  const std::string path = pathTemplate;
+  batched.pushN(batch, 5);
+  batched.saveSnapshot(path);
+
+  StackStaticArray<> restored(2);
+  restored.loadSnapshot(path);
+  assert(restored.size() == 5 && restored.top() == 14);
+  restored.push(15);
+  restored.push(16);
+  restored.push(17);
+  assert(restored.size() == 8 && restored.indexOf(10) == 0);
+  unlink(path.c_str());
+
+  StackStaticArray<CacheAlignedAllocation> aligned(1 << 20);
+
+  for (int i = 0; i < (1 << 20); i++) aligned.push(i);
+  assert(aligned.indexOf((1 << 20) - 1) == (1 << 20) - 1);
+  assert(aligned.pop() == (1 << 20) - 1);
+
   return 0;
 }
+#endif